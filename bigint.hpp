@@ -0,0 +1,593 @@
+#pragma once
+
+/**
+ * @file bigint.hpp
+ * @brief Aritmetika unsigned fixed-width di atas bytes<N>
+ * @version 1.0.0
+ *
+ * bytes<N> diperlakukan sebagai unsigned integer 8N bit (little-endian,
+ * byte 0 = LSB). Semua operasi modulo 2^(8N), sama seperti unsigned built-in.
+ *
+ * Menyediakan:
+ * - add/sub dengan carry chain per limb 64-bit (adc/sbb di x86-64)
+ * - Perkalian schoolbook (truncated) dan full product dengan Karatsuba
+ * - divmod dengan divisor 32-bit (cepat) dan divisor bytes<N> (Knuth D)
+ * - Perbandingan numerik dan to_chars/from_chars/to_string (base 2..36)
+ *
+ * @note Semua operasi constexpr dan noexcept
+ *
+ * @example
+ * ```cpp
+ * bytes<32> a(uint64_t{1}), b(~uint64_t{0});
+ * auto c = (a << 200) + b * b;
+ * auto [q, r] = divmod(c, b);
+ * std::string s = to_string(c);       // desimal
+ * std::string h = to_string(c, 16);   // hex
+ * ```
+ */
+
+#include "bytes.hpp"
+#include <charconv>
+#include <compare>
+#include <string>
+#include <system_error>
+
+namespace zuu {
+
+namespace detail {
+
+// ============= Limb Primitives =============
+
+/** @brief a + b + carry; carry diperbarui */
+[[nodiscard]] constexpr uint64_t addc(uint64_t a, uint64_t b, bool& carry) noexcept {
+#if defined(ZUU_SIMD_X86) && defined(__x86_64__)
+    if (!std::is_constant_evaluated()) {
+        unsigned long long r;
+        carry = _addcarry_u64(carry, a, b, &r);
+        return r;
+    }
+#endif
+    const uint64_t s = a + b;
+    const uint64_t r = s + carry;
+    carry = (s < a) | (r < s);
+    return r;
+}
+
+/** @brief a - b - borrow; borrow diperbarui */
+[[nodiscard]] constexpr uint64_t subb(uint64_t a, uint64_t b, bool& borrow) noexcept {
+#if defined(ZUU_SIMD_X86) && defined(__x86_64__)
+    if (!std::is_constant_evaluated()) {
+        unsigned long long r;
+        borrow = _subborrow_u64(borrow, a, b, &r);
+        return r;
+    }
+#endif
+    const uint64_t d = a - b;
+    const uint64_t r = d - borrow;
+    borrow = (a < b) | (d < static_cast<uint64_t>(borrow));
+    return r;
+}
+
+/** @brief 64x64 -> 128 bit; return low, hi diisi high */
+[[nodiscard]] constexpr uint64_t mul_wide(uint64_t a, uint64_t b, uint64_t& hi) noexcept {
+#ifdef __SIZEOF_INT128__
+    const unsigned __int128 p = static_cast<unsigned __int128>(a) * b;
+    hi = static_cast<uint64_t>(p >> 64);
+    return static_cast<uint64_t>(p);
+#else
+    const uint64_t a0 = a & 0xFFFFFFFFu, a1 = a >> 32;
+    const uint64_t b0 = b & 0xFFFFFFFFu, b1 = b >> 32;
+    const uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    const uint64_t mid = (p00 >> 32) + (p01 & 0xFFFFFFFFu) + (p10 & 0xFFFFFFFFu);
+    hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+    return (mid << 32) | (p00 & 0xFFFFFFFFu);
+#endif
+}
+
+/** @brief r[0..n) += x[0..xn) (xn <= n); return carry keluar */
+constexpr bool add_limbs(uint64_t* r, size_t n, const uint64_t* x, size_t xn) noexcept {
+    bool c = false;
+    size_t i = 0;
+    for (; i < xn; ++i) r[i] = addc(r[i], x[i], c);
+    for (; c && i < n; ++i) r[i] = addc(r[i], 0, c);
+    return c;
+}
+
+/** @brief r[0..n) -= x[0..xn) (xn <= n); return borrow keluar */
+constexpr bool sub_limbs(uint64_t* r, size_t n, const uint64_t* x, size_t xn) noexcept {
+    bool b = false;
+    size_t i = 0;
+    for (; i < xn; ++i) r[i] = subb(r[i], x[i], b);
+    for (; b && i < n; ++i) r[i] = subb(r[i], 0, b);
+    return b;
+}
+
+/** @brief r[0..na+nb) = a[0..na) * b[0..nb) (schoolbook) */
+constexpr void mul_school(uint64_t* r, const uint64_t* a, size_t na,
+                          const uint64_t* b, size_t nb) noexcept {
+    for (size_t i = 0; i < na + nb; ++i) r[i] = 0;
+    for (size_t i = 0; i < na; ++i) {
+        uint64_t carry = 0;
+        for (size_t j = 0; j < nb; ++j) {
+            uint64_t hi;
+            uint64_t lo = mul_wide(a[i], b[j], hi);
+            lo += carry;
+            hi += lo < carry;
+            const uint64_t s = r[i + j] + lo;
+            hi += s < lo;
+            r[i + j] = s;
+            carry = hi;
+        }
+        r[i + nb] = carry;
+    }
+}
+
+/** @brief r[0..n) = (a * b) mod 2^(64n), hanya limb bawah yang dihitung */
+constexpr void mul_low(uint64_t* r, const uint64_t* a, const uint64_t* b, size_t n) noexcept {
+    for (size_t i = 0; i < n; ++i) r[i] = 0;
+    for (size_t i = 0; i < n; ++i) {
+        uint64_t carry = 0;
+        for (size_t j = 0; i + j < n; ++j) {
+            uint64_t hi;
+            uint64_t lo = mul_wide(a[i], b[j], hi);
+            lo += carry;
+            hi += lo < carry;
+            const uint64_t s = r[i + j] + lo;
+            hi += s < lo;
+            r[i + j] = s;
+            carry = hi;
+        }
+    }
+}
+
+/** @brief Jumlah limb minimum dimana Karatsuba lebih cepat dari schoolbook */
+inline constexpr size_t karatsuba_threshold = 32;
+
+/**
+ * @brief r[0..2n) = a[0..n) * b[0..n)
+ *
+ * Karatsuba: a = a1*B + a0, b = b1*B + b0 (B = 2^(64*lo))
+ * a*b = z2*B^2 + (z1 - z0 - z2)*B + z0, z1 = (a0+a1)(b0+b1)
+ */
+template <size_t Nl>
+constexpr void mul_karatsuba(uint64_t* r, const uint64_t* a, const uint64_t* b) noexcept {
+    if constexpr (Nl < karatsuba_threshold) {
+        mul_school(r, a, Nl, b, Nl);
+    } else {
+        constexpr size_t lo = (Nl + 1) / 2;
+        constexpr size_t hi = Nl - lo;
+
+        // High half di-pad ke lo limb agar rekursi memakai satu ukuran
+        uint64_t a1[lo]{}, b1[lo]{};
+        for (size_t i = 0; i < hi; ++i) { a1[i] = a[lo + i]; b1[i] = b[lo + i]; }
+
+        uint64_t z0[2 * lo]{}, z2[2 * lo]{};
+        mul_karatsuba<lo>(z0, a, b);
+        mul_karatsuba<lo>(z2, a1, b1);
+
+        // sa = a0 + a1, sb = b0 + b1 (masing-masing lo limb + 1 bit carry)
+        uint64_t sa[lo]{}, sb[lo]{};
+        for (size_t i = 0; i < lo; ++i) { sa[i] = a[i]; sb[i] = b[i]; }
+        const bool ca = add_limbs(sa, lo, a1, lo);
+        const bool cb = add_limbs(sb, lo, b1, lo);
+
+        uint64_t z1[2 * lo + 1]{};
+        mul_karatsuba<lo>(z1, sa, sb);
+        if (ca) add_limbs(z1 + lo, lo + 1, sb, lo);
+        if (cb) add_limbs(z1 + lo, lo + 1, sa, lo);
+        if (ca && cb) z1[2 * lo] += 1;
+        sub_limbs(z1, 2 * lo + 1, z0, 2 * lo);
+        sub_limbs(z1, 2 * lo + 1, z2, 2 * lo);
+
+        for (size_t i = 0; i < 2 * lo; ++i) r[i] = z0[i];
+        for (size_t i = 0; i < 2 * hi; ++i) r[2 * lo + i] = z2[i];
+        const size_t rest = 2 * Nl - lo;
+        add_limbs(r + lo, rest, z1, rest < 2 * lo + 1 ? rest : 2 * lo + 1);
+    }
+}
+
+// ============= Division (32-bit digits) =============
+
+/** @brief Limb 64-bit -> digit 32-bit */
+template <size_t L>
+constexpr void to_digits(const uint64_t (&w)[L], uint32_t (&d)[2 * L]) noexcept {
+    for (size_t i = 0; i < L; ++i) {
+        d[2 * i] = static_cast<uint32_t>(w[i]);
+        d[2 * i + 1] = static_cast<uint32_t>(w[i] >> 32);
+    }
+}
+
+template <size_t L>
+constexpr void from_digits(const uint32_t (&d)[2 * L], uint64_t (&w)[L]) noexcept {
+    for (size_t i = 0; i < L; ++i)
+        w[i] = d[2 * i] | (static_cast<uint64_t>(d[2 * i + 1]) << 32);
+}
+
+/** @brief Jumlah digit signifikan (tanpa leading zero) */
+[[nodiscard]] constexpr size_t significant_digits(const uint32_t* d, size_t n) noexcept {
+    while (n > 0 && d[n - 1] == 0) --n;
+    return n;
+}
+
+/** @brief d[0..n) /= v in-place; return remainder */
+constexpr uint32_t div_digits_small(uint32_t* d, size_t n, uint32_t v) noexcept {
+    uint64_t rem = 0;
+    for (size_t i = n; i-- > 0;) {
+        const uint64_t cur = (rem << 32) | d[i];
+        d[i] = static_cast<uint32_t>(cur / v);
+        rem = cur % v;
+    }
+    return static_cast<uint32_t>(rem);
+}
+
+/**
+ * @brief Knuth Algorithm D (Hacker's Delight divmnu) pada digit 32-bit
+ * @param q Quotient (m digit), r Remainder (n digit)
+ * @pre n >= 2, m >= n, v[n-1] != 0
+ */
+template <size_t D>
+constexpr void div_digits_knuth(const uint32_t* u, size_t m, const uint32_t* v, size_t n,
+                                uint32_t* q, uint32_t* r) noexcept {
+    constexpr uint64_t b = uint64_t{1} << 32;
+    const int s = std::countl_zero(v[n - 1]);
+
+    uint32_t vn[D]{};
+    uint32_t un[D + 1]{};
+    for (size_t i = n - 1; i > 0; --i)
+        vn[i] = static_cast<uint32_t>((static_cast<uint64_t>(v[i]) << s) |
+                                      (static_cast<uint64_t>(v[i - 1]) >> (32 - s)));
+    vn[0] = v[0] << s;
+    un[m] = static_cast<uint32_t>(static_cast<uint64_t>(u[m - 1]) >> (32 - s));
+    for (size_t i = m - 1; i > 0; --i)
+        un[i] = static_cast<uint32_t>((static_cast<uint64_t>(u[i]) << s) |
+                                      (static_cast<uint64_t>(u[i - 1]) >> (32 - s)));
+    un[0] = u[0] << s;
+
+    for (size_t j = m - n + 1; j-- > 0;) {
+        const uint64_t num = (static_cast<uint64_t>(un[j + n]) << 32) | un[j + n - 1];
+        uint64_t qhat = num / vn[n - 1];
+        uint64_t rhat = num - qhat * vn[n - 1];
+        while (qhat >= b || qhat * vn[n - 2] > ((rhat << 32) | un[j + n - 2])) {
+            --qhat;
+            rhat += vn[n - 1];
+            if (rhat >= b) break;
+        }
+
+        // Multiply and subtract
+        int64_t k = 0;
+        int64_t t = 0;
+        for (size_t i = 0; i < n; ++i) {
+            const uint64_t p = qhat * vn[i];
+            t = static_cast<int64_t>(un[i + j]) - k - static_cast<int64_t>(p & 0xFFFFFFFFu);
+            un[i + j] = static_cast<uint32_t>(t);
+            k = static_cast<int64_t>(p >> 32) - (t >> 32);
+        }
+        t = static_cast<int64_t>(un[j + n]) - k;
+        un[j + n] = static_cast<uint32_t>(t);
+
+        q[j] = static_cast<uint32_t>(qhat);
+        if (t < 0) {
+            // Add back (jarang terjadi)
+            --q[j];
+            uint64_t c = 0;
+            for (size_t i = 0; i < n; ++i) {
+                const uint64_t sum = static_cast<uint64_t>(un[i + j]) + vn[i] + c;
+                un[i + j] = static_cast<uint32_t>(sum);
+                c = sum >> 32;
+            }
+            un[j + n] = static_cast<uint32_t>(un[j + n] + c);
+        }
+    }
+
+    for (size_t i = 0; i + 1 < n; ++i)
+        r[i] = static_cast<uint32_t>((static_cast<uint64_t>(un[i]) >> s) |
+                                     (static_cast<uint64_t>(un[i + 1]) << (32 - s)));
+    r[n - 1] = un[n - 1] >> s;
+}
+
+// ============= Formatting Helpers =============
+
+/** @brief Digit char untuk nilai 0..35 */
+[[nodiscard]] constexpr char digit_char(uint32_t d) noexcept {
+    return static_cast<char>(d < 10 ? '0' + d : 'a' + (d - 10));
+}
+
+/** @brief Nilai digit dari char, atau 255 jika bukan digit */
+[[nodiscard]] constexpr uint32_t digit_value(char c) noexcept {
+    if (c >= '0' && c <= '9') return static_cast<uint32_t>(c - '0');
+    if (c >= 'a' && c <= 'z') return static_cast<uint32_t>(c - 'a' + 10);
+    if (c >= 'A' && c <= 'Z') return static_cast<uint32_t>(c - 'A' + 10);
+    return 255;
+}
+
+/** @brief base^k terbesar yang muat 32 bit, beserta k */
+struct digit_chunk {
+    uint32_t divisor;
+    uint32_t digits;
+};
+
+[[nodiscard]] constexpr digit_chunk chunk_for_base(uint32_t base) noexcept {
+    uint64_t p = base;
+    uint32_t k = 1;
+    while (p * base <= 0xFFFFFFFFu) { p *= base; ++k; }
+    return {static_cast<uint32_t>(p), k};
+}
+
+} // namespace detail
+
+// ============= Addition / Subtraction =============
+
+/**
+ * @brief out = a + b (mod 2^(8N))
+ * @return true jika terjadi carry keluar dari bit 8N-1
+ */
+template <size_t N>
+constexpr bool add_overflow(const bytes<N>& a, const bytes<N>& b, bytes<N>& out) noexcept {
+    auto x = a.to_limbs();
+    const auto y = b.to_limbs();
+    bool carry = detail::add_limbs(x.w, bytes<N>::limb_count, y.w, bytes<N>::limb_count);
+    if constexpr (N % 8 != 0) {
+        // Carry jatuh ke padding limb terakhir
+        carry = (x.w[bytes<N>::limb_count - 1] >> ((N % 8) * 8)) != 0;
+    }
+    out = bytes<N>::from_limbs(x);
+    return carry;
+}
+
+/**
+ * @brief out = a - b (mod 2^(8N))
+ * @return true jika terjadi borrow (a < b)
+ */
+template <size_t N>
+constexpr bool sub_overflow(const bytes<N>& a, const bytes<N>& b, bytes<N>& out) noexcept {
+    auto x = a.to_limbs();
+    const auto y = b.to_limbs();
+    const bool borrow = detail::sub_limbs(x.w, bytes<N>::limb_count, y.w, bytes<N>::limb_count);
+    out = bytes<N>::from_limbs(x);
+    return borrow;
+}
+
+template <size_t N>
+[[nodiscard]] constexpr bytes<N> operator+(const bytes<N>& a, const bytes<N>& b) noexcept {
+    bytes<N> r;
+    add_overflow(a, b, r);
+    return r;
+}
+
+template <size_t N>
+[[nodiscard]] constexpr bytes<N> operator-(const bytes<N>& a, const bytes<N>& b) noexcept {
+    bytes<N> r;
+    sub_overflow(a, b, r);
+    return r;
+}
+
+// ============= Multiplication =============
+
+/** @brief a * b (mod 2^(8N)), schoolbook hanya untuk limb bawah */
+template <size_t N>
+[[nodiscard]] constexpr bytes<N> operator*(const bytes<N>& a, const bytes<N>& b) noexcept {
+    const auto x = a.to_limbs();
+    const auto y = b.to_limbs();
+    typename bytes<N>::limb_array r{};
+    detail::mul_low(r.w, x.w, y.w, bytes<N>::limb_count);
+    return bytes<N>::from_limbs(r);
+}
+
+/**
+ * @brief Full product a * b tanpa overflow
+ * @note Karatsuba jika limb_count >= detail::karatsuba_threshold
+ */
+template <size_t N>
+[[nodiscard]] constexpr bytes<2 * N> mul_full(const bytes<N>& a, const bytes<N>& b) noexcept {
+    constexpr size_t L = bytes<N>::limb_count;
+    const auto x = a.to_limbs();
+    const auto y = b.to_limbs();
+    typename bytes<2 * N>::limb_array r{};
+    uint64_t full[2 * L]{};
+    detail::mul_karatsuba<L>(full, x.w, y.w);
+    for (size_t i = 0; i < bytes<2 * N>::limb_count; ++i) r.w[i] = full[i];
+    return bytes<2 * N>::from_limbs(r);
+}
+
+// ============= Division =============
+
+/** @brief Hasil divmod */
+template <size_t N, typename R = bytes<N>>
+struct divmod_result {
+    bytes<N> quotient;
+    R remainder;
+};
+
+/**
+ * @brief Bagi dengan divisor 32-bit (satu pembagian 64/32 per digit)
+ * @note d == 0: quotient semua bit 1, remainder = 32 bit bawah a (tidak ada UB)
+ */
+template <size_t N>
+[[nodiscard]] constexpr divmod_result<N, uint32_t> divmod(const bytes<N>& a, uint32_t d) noexcept {
+    constexpr size_t L = bytes<N>::limb_count;
+    if (d == 0) return {~bytes<N>{}, a.template to_int<uint32_t>()};
+
+    const auto x = a.to_limbs();
+    uint32_t digits[2 * L]{};
+    detail::to_digits(x.w, digits);
+    const uint32_t rem = detail::div_digits_small(
+        digits, detail::significant_digits(digits, 2 * L), d);
+
+    typename bytes<N>::limb_array q{};
+    detail::from_digits(digits, q.w);
+    return {bytes<N>::from_limbs(q), rem};
+}
+
+/**
+ * @brief Bagi dengan divisor N-byte (Knuth Algorithm D)
+ * @note d == 0: quotient semua bit 1, remainder = a (tidak ada UB)
+ */
+template <size_t N>
+[[nodiscard]] constexpr divmod_result<N> divmod(const bytes<N>& a, const bytes<N>& d) noexcept {
+    constexpr size_t L = bytes<N>::limb_count;
+    constexpr size_t D = 2 * L;
+
+    uint32_t u[D]{}, v[D]{};
+    detail::to_digits(a.to_limbs().w, u);
+    detail::to_digits(d.to_limbs().w, v);
+    const size_t m = detail::significant_digits(u, D);
+    const size_t n = detail::significant_digits(v, D);
+
+    if (n == 0) return {~bytes<N>{}, a};
+    if (m < n) return {bytes<N>{}, a};
+
+    uint32_t q[D]{}, r[D]{};
+    if (n == 1) {
+        for (size_t i = 0; i < m; ++i) q[i] = u[i];
+        r[0] = detail::div_digits_small(q, m, v[0]);
+    } else {
+        detail::div_digits_knuth<D>(u, m, v, n, q, r);
+    }
+
+    typename bytes<N>::limb_array ql{}, rl{};
+    detail::from_digits(q, ql.w);
+    detail::from_digits(r, rl.w);
+    return {bytes<N>::from_limbs(ql), bytes<N>::from_limbs(rl)};
+}
+
+template <size_t N>
+[[nodiscard]] constexpr bytes<N> operator/(const bytes<N>& a, const bytes<N>& b) noexcept {
+    return divmod(a, b).quotient;
+}
+
+template <size_t N>
+[[nodiscard]] constexpr bytes<N> operator%(const bytes<N>& a, const bytes<N>& b) noexcept {
+    return divmod(a, b).remainder;
+}
+
+// ============= Compound Assignment =============
+
+template <size_t N>
+constexpr bytes<N>& operator+=(bytes<N>& a, const bytes<N>& b) noexcept { return a = a + b; }
+
+template <size_t N>
+constexpr bytes<N>& operator-=(bytes<N>& a, const bytes<N>& b) noexcept { return a = a - b; }
+
+template <size_t N>
+constexpr bytes<N>& operator*=(bytes<N>& a, const bytes<N>& b) noexcept { return a = a * b; }
+
+template <size_t N>
+constexpr bytes<N>& operator/=(bytes<N>& a, const bytes<N>& b) noexcept { return a = a / b; }
+
+template <size_t N>
+constexpr bytes<N>& operator%=(bytes<N>& a, const bytes<N>& b) noexcept { return a = a % b; }
+
+// ============= Comparison =============
+
+/**
+ * @brief Bandingkan sebagai unsigned integer (limb paling signifikan dahulu)
+ * @note Berbeda dengan operator<=> bawaan bytes yang leksikografis per byte
+ */
+template <size_t N>
+[[nodiscard]] constexpr std::strong_ordering compare(const bytes<N>& a, const bytes<N>& b) noexcept {
+    return a.template compare<numeric_order>(b);
+}
+
+// ============= Formatting =============
+
+/**
+ * @brief Tulis nilai dalam base 2..36 (huruf kecil, tanpa prefix)
+ * @return Seperti std::to_chars; errc::value_too_large jika buffer kurang
+ */
+template <size_t N>
+constexpr std::to_chars_result to_chars(char* first, char* last, const bytes<N>& value,
+                                        int base = 10) noexcept {
+    constexpr size_t L = bytes<N>::limb_count;
+    char buf[N * 8 + 1]{};
+    size_t len = 0;
+
+    const uint32_t ubase = static_cast<uint32_t>(base < 2 ? 2 : (base > 36 ? 36 : base));
+    if (std::has_single_bit(ubase)) {
+        // Base pangkat dua: ambil bit langsung tanpa pembagian
+        const unsigned bits = static_cast<unsigned>(std::countr_zero(ubase));
+        const auto x = value.to_limbs();
+        for (size_t pos = 0; pos < N * 8; pos += bits) {
+            uint32_t d = 0;
+            for (unsigned k = 0; k < bits && pos + k < N * 8; ++k)
+                d |= static_cast<uint32_t>((x.w[(pos + k) / 64] >> ((pos + k) % 64)) & 1u) << k;
+            buf[len++] = detail::digit_char(d);
+        }
+    } else {
+        const auto chunk = detail::chunk_for_base(ubase);
+        uint32_t digits[2 * L]{};
+        detail::to_digits(value.to_limbs().w, digits);
+        size_t n = detail::significant_digits(digits, 2 * L);
+        while (n > 0) {
+            uint32_t rem = detail::div_digits_small(digits, n, chunk.divisor);
+            n = detail::significant_digits(digits, n);
+            // Chunk di tengah angka selalu chunk.digits digit (dengan leading zero)
+            for (uint32_t k = 0; k < chunk.digits && (n > 0 || rem != 0); ++k) {
+                buf[len++] = detail::digit_char(rem % ubase);
+                rem /= ubase;
+            }
+        }
+    }
+
+    while (len > 1 && buf[len - 1] == '0') --len;
+    if (len == 0) buf[len++] = '0';
+
+    if (static_cast<size_t>(last - first) < len) return {last, std::errc::value_too_large};
+    for (size_t i = 0; i < len; ++i) first[i] = buf[len - 1 - i];
+    return {first + len, std::errc{}};
+}
+
+/**
+ * @brief Parse unsigned integer base 2..36 (tanpa prefix/tanda)
+ * @return Seperti std::from_chars: invalid_argument jika tidak ada digit,
+ *         result_out_of_range jika nilai tidak muat 8N bit
+ */
+template <size_t N>
+constexpr std::from_chars_result from_chars(const char* first, const char* last, bytes<N>& value,
+                                            int base = 10) noexcept {
+    constexpr size_t L = bytes<N>::limb_count;
+    const uint32_t ubase = static_cast<uint32_t>(base < 2 ? 2 : (base > 36 ? 36 : base));
+    const auto chunk = detail::chunk_for_base(ubase);
+
+    typename bytes<N>::limb_array acc{};
+    bool overflow = false;
+    const char* p = first;
+
+    while (p != last && detail::digit_value(*p) < ubase) {
+        // Kumpulkan hingga chunk.digits digit ke satu word 32-bit
+        uint32_t part = 0, scale = 1;
+        for (uint32_t k = 0; k < chunk.digits && p != last; ++k, ++p) {
+            const uint32_t d = detail::digit_value(*p);
+            if (d >= ubase) break;
+            part = part * ubase + d;
+            scale *= ubase;
+        }
+
+        // acc = acc * scale + part
+        uint64_t carry = part;
+        for (size_t i = 0; i < L; ++i) {
+            uint64_t hi;
+            uint64_t lo = detail::mul_wide(acc.w[i], scale, hi);
+            lo += carry;
+            hi += lo < carry;
+            acc.w[i] = lo;
+            carry = hi;
+        }
+        overflow |= carry != 0;
+        if constexpr (N % 8 != 0) overflow |= (acc.w[L - 1] >> ((N % 8) * 8)) != 0;
+    }
+
+    if (p == first) return {first, std::errc::invalid_argument};
+    if (overflow) return {p, std::errc::result_out_of_range};
+    value = bytes<N>::from_limbs(acc);
+    return {p, std::errc{}};
+}
+
+/** @brief Format ke std::string (base 2..36) */
+template <size_t N>
+[[nodiscard]] std::string to_string(const bytes<N>& value, int base = 10) {
+    char buf[N * 8 + 1];
+    const auto res = to_chars(buf, buf + sizeof(buf), value, base);
+    return std::string(buf, res.ptr);
+}
+
+} // namespace zuu
@@ -0,0 +1,778 @@
+#pragma once
+
+/**
+ * @file byte_buffer.hpp
+ * @brief Byte array runtime-sized dengan API bytes<N>
+ * @version 1.0.0
+ *
+ * Menyediakan:
+ * - byte_buffer: owning, aligned 64 byte, growable
+ * - bytes_view / mutable_bytes_view: non-owning di atas memori eksternal
+ *   (mis. region mmap, buffer network, bytes<N>)
+ *
+ * Operasi bitwise, shift, popcount, bit search dan endian sama dengan
+ * bytes<N>. Loop bitwise dan popcount memakai kernel SIMD (simd.hpp) dan
+ * lainnya bekerja per word 64-bit, sehingga cocok untuk panjang multi-MB.
+ *
+ * @note Operand dengan panjang berbeda diperlakukan zero-extended ke
+ *       panjang operand kiri
+ */
+
+#include "bytes.hpp"
+#include "simd.hpp"
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace zuu {
+
+// ============= Forward Declarations =============
+
+class byte_buffer;
+
+template <typename Byte>
+requires std::is_same_v<std::remove_const_t<Byte>, uint8_t>
+class basic_bytes_view;
+
+/** @brief View read-only */
+using bytes_view = basic_bytes_view<const uint8_t>;
+
+/** @brief View yang dapat memodifikasi memori yang dirujuk */
+using mutable_bytes_view = basic_bytes_view<uint8_t>;
+
+namespace detail {
+
+// ============= Word Helpers =============
+
+// load_le64 / store_le64 / word_at: lihat bytes.hpp
+
+/** @brief Mask bit valid pada word ke-i */
+[[nodiscard]] inline uint64_t word_mask(size_t n, size_t i) noexcept {
+    const size_t valid = n - i * 8;
+    return valid >= 8 ? ~uint64_t{0} : (uint64_t{1} << (valid * 8)) - 1;
+}
+
+// ============= Shift Kernels =============
+
+/** @brief Shift left (ke index bit lebih tinggi) in-place */
+inline void shift_left_bits(uint8_t* p, size_t n, size_t bits) noexcept {
+    if (bits == 0 || n == 0) return;
+    if (bits >= n * 8) { std::memset(p, 0, n); return; }
+
+    const size_t byte_sh = bits / 8;
+    const unsigned s = static_cast<unsigned>(bits % 8);
+    if (byte_sh != 0) {
+        std::memmove(p + byte_sh, p, n - byte_sh);
+        std::memset(p, 0, byte_sh);
+    }
+    if (s == 0) return;
+
+    // Dari atas ke bawah: word [i-8, i) mendapat carry dari byte i-9
+    // (belum dimodifikasi karena berada di bawah)
+    size_t i = n;
+    for (; i >= 9; i -= 8) {
+        const uint64_t w = load_le64(p + i - 8);
+        store_le64(p + i - 8, (w << s) | (p[i - 9] >> (8 - s)));
+    }
+    while (i-- > 0) {
+        p[i] = static_cast<uint8_t>((p[i] << s) | (i > 0 ? p[i - 1] >> (8 - s) : 0));
+    }
+}
+
+/** @brief Shift right (ke index bit lebih rendah) in-place */
+inline void shift_right_bits(uint8_t* p, size_t n, size_t bits) noexcept {
+    if (bits == 0 || n == 0) return;
+    if (bits >= n * 8) { std::memset(p, 0, n); return; }
+
+    const size_t byte_sh = bits / 8;
+    const unsigned s = static_cast<unsigned>(bits % 8);
+    if (byte_sh != 0) {
+        std::memmove(p, p + byte_sh, n - byte_sh);
+        std::memset(p + n - byte_sh, 0, byte_sh);
+    }
+    if (s == 0) return;
+
+    // Dari bawah ke atas: word [i, i+8) mendapat carry dari byte i+8
+    size_t i = 0;
+    for (; i + 9 <= n; i += 8) {
+        const uint64_t w = load_le64(p + i);
+        store_le64(p + i, (w >> s) | (static_cast<uint64_t>(p[i + 8]) << (64 - s)));
+    }
+    for (; i < n; ++i) {
+        p[i] = static_cast<uint8_t>((p[i] >> s) | (i + 1 < n ? p[i + 1] << (8 - s) : 0));
+    }
+}
+
+// ============= Set Bit Iterator =============
+
+/** @brief Forward iterator atas posisi bit set dalam p[0..n) */
+class set_bit_cursor {
+    const uint8_t* p_ = nullptr;
+    size_t n_ = 0;
+    size_t word_index_ = 0;
+    size_t words_ = 0;
+    uint64_t word_ = 0;
+
+    void skip_empty() noexcept {
+        while (word_ == 0 && ++word_index_ < words_) word_ = word_at(p_, n_, word_index_);
+    }
+
+public:
+    using value_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using iterator_category = std::forward_iterator_tag;
+
+    set_bit_cursor() noexcept = default;
+
+    set_bit_cursor(const uint8_t* p, size_t n) noexcept
+        : p_(p), n_(n), words_((n + 7) / 8), word_(n ? word_at(p, n, 0) : 0) {
+        if (words_ == 0) return;
+        skip_empty();
+        if (word_ == 0) word_index_ = 0;
+    }
+
+    [[nodiscard]] size_t operator*() const noexcept {
+        return word_index_ * 64 + static_cast<size_t>(std::countr_zero(word_));
+    }
+
+    set_bit_cursor& operator++() noexcept {
+        word_ &= word_ - 1;
+        skip_empty();
+        if (word_ == 0) word_index_ = 0;
+        return *this;
+    }
+
+    set_bit_cursor operator++(int) noexcept {
+        set_bit_cursor tmp = *this;
+        ++*this;
+        return tmp;
+    }
+
+    /** @brief Iterator habis jika word_ == 0 (end() default-constructed) */
+    [[nodiscard]] bool operator==(const set_bit_cursor& o) const noexcept {
+        return word_ == o.word_ && word_index_ == o.word_index_;
+    }
+};
+
+// ============= CRTP Operations =============
+
+/**
+ * @brief Operasi read-only untuk tipe dengan data() dan size()
+ * @note Pencarian mengembalikan bit_size() jika tidak ditemukan
+ */
+template <typename Derived>
+class byte_span_ops {
+    [[nodiscard]] const uint8_t* ptr() const noexcept {
+        return static_cast<const Derived&>(*this).data();
+    }
+    [[nodiscard]] size_t len() const noexcept {
+        return static_cast<const Derived&>(*this).size();
+    }
+    [[nodiscard]] size_t word_count() const noexcept { return (len() + 7) / 8; }
+
+public:
+    // ============= Capacity =============
+
+    [[nodiscard]] size_t bit_size() const noexcept { return len() * 8; }
+
+    // ============= Bit Queries =============
+
+    [[nodiscard]] bool test_bit(size_t pos) const noexcept {
+        return pos < bit_size() && (ptr()[pos / 8] & (1u << (pos % 8))) != 0;
+    }
+
+    [[nodiscard]] size_t popcount() const noexcept { return simd::popcount(ptr(), len()); }
+
+    // ============= Bit Search =============
+
+    [[nodiscard]] size_t countr_zero() const noexcept {
+        const size_t w = word_count();
+        for (size_t i = 0; i < w; ++i) {
+            const uint64_t v = word_at(ptr(), len(), i);
+            if (v != 0) return i * 64 + static_cast<size_t>(std::countr_zero(v));
+        }
+        return bit_size();
+    }
+
+    [[nodiscard]] size_t countl_zero() const noexcept {
+        for (size_t i = word_count(); i-- > 0;) {
+            const uint64_t v = word_at(ptr(), len(), i);
+            if (v != 0) {
+                const size_t top = i * 64 + 63 - static_cast<size_t>(std::countl_zero(v));
+                return bit_size() - 1 - top;
+            }
+        }
+        return bit_size();
+    }
+
+    [[nodiscard]] size_t find_first_set() const noexcept { return countr_zero(); }
+
+    /** @brief Bit set pertama > pos */
+    [[nodiscard]] size_t find_next_set(size_t pos) const noexcept {
+        if (++pos >= bit_size()) return bit_size();
+        const size_t w = word_count();
+        size_t i = pos / 64;
+        uint64_t v = word_at(ptr(), len(), i) & (~uint64_t{0} << (pos % 64));
+        while (v == 0) {
+            if (++i == w) return bit_size();
+            v = word_at(ptr(), len(), i);
+        }
+        return i * 64 + static_cast<size_t>(std::countr_zero(v));
+    }
+
+    [[nodiscard]] size_t find_first_clear() const noexcept {
+        const size_t w = word_count();
+        for (size_t i = 0; i < w; ++i) {
+            const uint64_t v = ~word_at(ptr(), len(), i) & word_mask(len(), i);
+            if (v != 0) return i * 64 + static_cast<size_t>(std::countr_zero(v));
+        }
+        return bit_size();
+    }
+
+    /** @brief Bit clear pertama > pos */
+    [[nodiscard]] size_t find_next_clear(size_t pos) const noexcept {
+        if (++pos >= bit_size()) return bit_size();
+        const size_t w = word_count();
+        size_t i = pos / 64;
+        uint64_t v = ~word_at(ptr(), len(), i) & word_mask(len(), i) & (~uint64_t{0} << (pos % 64));
+        while (v == 0) {
+            if (++i == w) return bit_size();
+            v = ~word_at(ptr(), len(), i) & word_mask(len(), i);
+        }
+        return i * 64 + static_cast<size_t>(std::countr_zero(v));
+    }
+
+    /** @brief Range posisi bit set: for (size_t pos : v.set_bits()) */
+    struct set_bit_range {
+        const uint8_t* p;
+        size_t n;
+
+        [[nodiscard]] set_bit_cursor begin() const noexcept { return set_bit_cursor(p, n); }
+        [[nodiscard]] set_bit_cursor end() const noexcept { return {}; }
+    };
+
+    [[nodiscard]] set_bit_range set_bits() const noexcept { return {ptr(), len()}; }
+
+    // ============= Conversion =============
+
+    /** @brief Baca sizeof(IntT) byte pertama sebagai little-endian integer */
+    template <typename IntT>
+    requires std::is_integral_v<IntT>
+    [[nodiscard]] IntT to_int() const noexcept {
+        IntT r = 0;
+        const size_t copy = sizeof(IntT) < len() ? sizeof(IntT) : len();
+        for (size_t i = 0; i < copy; ++i) r |= static_cast<IntT>(static_cast<IntT>(ptr()[i]) << (i * 8));
+        return r;
+    }
+
+    /**
+     * @brief Baca integer dengan endian sumber tertentu
+     * @note Sama seperti bytes<N>::to_int(endian_t): seluruh span dibalik
+     *       jika source_endian != native, lalu dibaca seperti to_int<IntT>()
+     */
+    template <typename IntT>
+    requires std::is_integral_v<IntT>
+    [[nodiscard]] IntT to_int(endian_t source_endian) const noexcept {
+        if (source_endian == native_endian) return to_int<IntT>();
+        IntT r = 0;
+        const size_t n = len();
+        const size_t copy = sizeof(IntT) < n ? sizeof(IntT) : n;
+        for (size_t i = 0; i < copy; ++i) r |= static_cast<IntT>(static_cast<IntT>(ptr()[n - 1 - i]) << (i * 8));
+        return r;
+    }
+
+    // ============= Endian Conversion =============
+    //
+    // Salinan (byte_buffer) seperti bytes<N>; versi in-place ada di
+    // make_little_endian / make_big_endian / swap_bytes (mutable).
+
+    [[nodiscard]] byte_buffer to_little_endian() const;
+    [[nodiscard]] byte_buffer to_big_endian() const;
+    [[nodiscard]] byte_buffer to_network() const;
+    [[nodiscard]] byte_buffer from_little_endian() const;
+    [[nodiscard]] byte_buffer from_big_endian() const;
+    [[nodiscard]] byte_buffer from_network() const;
+    [[nodiscard]] byte_buffer to_endian(endian_t target) const;
+    [[nodiscard]] byte_buffer from_endian(endian_t source) const;
+};
+
+/** @brief Operasi mutating (in-place) di atas byte_span_ops */
+template <typename Derived>
+class byte_span_mut_ops : public byte_span_ops<Derived> {
+    [[nodiscard]] uint8_t* mptr() noexcept { return static_cast<Derived&>(*this).data(); }
+    [[nodiscard]] size_t mlen() const noexcept { return static_cast<const Derived&>(*this).size(); }
+    [[nodiscard]] Derived& self() noexcept { return static_cast<Derived&>(*this); }
+
+    template <simd::bit_op Op>
+    Derived& apply(const uint8_t* o, size_t on) noexcept {
+        const size_t n = on < mlen() ? on : mlen();
+        simd::bitwise<Op>(mptr(), mptr(), o, n);
+        // Operand kanan zero-extended: hanya AND yang mengubah sisa
+        if constexpr (Op == simd::bit_op::and_) {
+            if (mlen() > n) std::memset(mptr() + n, 0, mlen() - n);
+        }
+        return self();
+    }
+
+public:
+    // ============= Bit Manipulation =============
+
+    void set_bit(size_t pos) noexcept {
+        if (pos < this->bit_size()) mptr()[pos / 8] |= static_cast<uint8_t>(1u << (pos % 8));
+    }
+
+    void clear_bit(size_t pos) noexcept {
+        if (pos < this->bit_size()) mptr()[pos / 8] &= static_cast<uint8_t>(~(1u << (pos % 8)));
+    }
+
+    void toggle_bit(size_t pos) noexcept {
+        if (pos < this->bit_size()) mptr()[pos / 8] ^= static_cast<uint8_t>(1u << (pos % 8));
+    }
+
+    // ============= Compound Assignment =============
+
+    Derived& operator|=(bytes_view o) noexcept;
+    Derived& operator&=(bytes_view o) noexcept;
+    Derived& operator^=(bytes_view o) noexcept;
+
+    /** @brief Invert semua bit in-place */
+    Derived& flip() noexcept {
+        simd::bitwise<simd::bit_op::not_>(mptr(), mptr(), mptr(), mlen());
+        return self();
+    }
+
+    Derived& operator<<=(size_t bits) noexcept {
+        shift_left_bits(mptr(), mlen(), bits);
+        return self();
+    }
+
+    Derived& operator>>=(size_t bits) noexcept {
+        shift_right_bits(mptr(), mlen(), bits);
+        return self();
+    }
+
+    // ============= Modifiers =============
+
+    void fill(uint8_t v) noexcept { std::memset(mptr(), v, mlen()); }
+
+    /** @brief Isi nol (sama seperti bytes<N>::clear, ukuran tidak berubah) */
+    void clear() noexcept { fill(0); }
+
+    // ============= Endian Conversion =============
+
+    /** @brief Reverse bytes in-place */
+    void swap_bytes() noexcept { std::reverse(mptr(), mptr() + mlen()); }
+
+    /** @brief Convert to little-endian in-place (no-op pada little-endian) */
+    void make_little_endian() noexcept {
+        if constexpr (!is_little_endian) swap_bytes();
+    }
+
+    /** @brief Convert to big-endian in-place (no-op pada big-endian) */
+    void make_big_endian() noexcept {
+        if constexpr (!is_big_endian) swap_bytes();
+    }
+};
+
+} // namespace detail
+
+// ============= Views =============
+
+/**
+ * @brief View non-owning di atas byte eksternal
+ * @tparam Byte uint8_t (mutable) atau const uint8_t (read-only)
+ *
+ * @example
+ * ```cpp
+ * bytes_view v(mmap_ptr, mmap_len);
+ * size_t ones = v.popcount();
+ * mutable_bytes_view m(buf, len);
+ * m |= v;                      // in-place, kernel SIMD
+ * ```
+ */
+template <typename Byte>
+requires std::is_same_v<std::remove_const_t<Byte>, uint8_t>
+class basic_bytes_view
+    : public std::conditional_t<std::is_const_v<Byte>,
+                                detail::byte_span_ops<basic_bytes_view<Byte>>,
+                                detail::byte_span_mut_ops<basic_bytes_view<Byte>>> {
+    Byte* data_ = nullptr;
+    size_t size_ = 0;
+
+public:
+    // ============= Type Aliases =============
+    using byte_t = uint8_t;
+    using size_type = size_t;
+    using value_type = byte_t;
+    using pointer = Byte*;
+    using reference = Byte&;
+
+    // ============= Constructors =============
+
+    constexpr basic_bytes_view() noexcept = default;
+
+    /** @brief View atas pointer + length */
+    constexpr basic_bytes_view(Byte* data, size_type len) noexcept : data_(data), size_(len) {}
+
+    /** @brief View atas span */
+    template <size_t Extent>
+    constexpr basic_bytes_view(std::span<Byte, Extent> s) noexcept : data_(s.data()), size_(s.size()) {}
+
+    /** @brief View atas bytes<N> */
+    template <size_t N>
+    requires std::is_const_v<Byte>
+    constexpr basic_bytes_view(const bytes<N>& b) noexcept : data_(b.data()), size_(N) {}
+
+    template <size_t N>
+    constexpr basic_bytes_view(bytes<N>& b) noexcept : data_(b.data()), size_(N) {}
+
+    /** @brief mutable_bytes_view -> bytes_view */
+    template <typename Other>
+    requires (std::is_const_v<Byte> && !std::is_const_v<Other>)
+    constexpr basic_bytes_view(const basic_bytes_view<Other>& o) noexcept
+        : data_(o.data()), size_(o.size()) {}
+
+    // ============= Element Access =============
+
+    [[nodiscard]] constexpr reference operator[](size_type i) const noexcept { return data_[i]; }
+    [[nodiscard]] constexpr pointer data() const noexcept { return data_; }
+
+    // ============= Capacity =============
+
+    [[nodiscard]] constexpr size_type size() const noexcept { return size_; }
+    [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+
+    // ============= Iterators =============
+
+    [[nodiscard]] constexpr pointer begin() const noexcept { return data_; }
+    [[nodiscard]] constexpr pointer end() const noexcept { return data_ + size_; }
+
+    // ============= Subview =============
+
+    /** @brief Subview [offset, offset + count), dipotong ke ukuran view */
+    [[nodiscard]] constexpr basic_bytes_view subview(size_type offset,
+                                                     size_type count = static_cast<size_type>(-1)) const noexcept {
+        if (offset > size_) offset = size_;
+        const size_type rest = size_ - offset;
+        return {data_ + offset, count < rest ? count : rest};
+    }
+};
+
+// ============= Owning Buffer =============
+
+/**
+ * @brief Byte array owning, aligned 64 byte, dapat bertambah ukuran
+ *
+ * Memory layout: satu blok heap aligned ke cache line, capacity >= size.
+ *
+ * @example
+ * ```cpp
+ * byte_buffer mask(config.rows / 8);      // zero-filled
+ * mask.set_bit(42);
+ * mask &= bytes_view(filter_ptr, filter_len);
+ * for (size_t row : mask.set_bits()) { ... }
+ * ```
+ */
+class byte_buffer : public detail::byte_span_mut_ops<byte_buffer> {
+public:
+    // ============= Type Aliases =============
+    using byte_t = uint8_t;
+    using size_type = size_t;
+    using value_type = byte_t;
+    using pointer = byte_t*;
+    using const_pointer = const byte_t*;
+    using reference = byte_t&;
+    using const_reference = const byte_t&;
+
+    static constexpr size_type alignment = 64;
+
+private:
+    byte_t* data_ = nullptr;
+    size_type size_ = 0;
+    size_type capacity_ = 0;
+
+    [[nodiscard]] static byte_t* allocate(size_type n) {
+        return n ? static_cast<byte_t*>(::operator new(n, std::align_val_t{alignment})) : nullptr;
+    }
+
+    static void deallocate(byte_t* p) noexcept {
+        if (p) ::operator delete(p, std::align_val_t{alignment});
+    }
+
+public:
+    // ============= Constructors =============
+
+    byte_buffer() noexcept = default;
+
+    /** @brief Buffer n byte diisi fill_value */
+    explicit byte_buffer(size_type n, byte_t fill_value = 0)
+        : data_(allocate(n)), size_(n), capacity_(n) {
+        if (n) std::memset(data_, fill_value, n);
+    }
+
+    /** @brief Salin dari view */
+    explicit byte_buffer(bytes_view v) : byte_buffer(v.size()) {
+        if (!v.empty()) std::memcpy(data_, v.data(), v.size());
+    }
+
+    /** @brief Salin dari bytes<N> */
+    template <size_t N>
+    explicit byte_buffer(const bytes<N>& b) : byte_buffer(bytes_view(b)) {}
+
+    byte_buffer(const byte_buffer& o) : byte_buffer(bytes_view(o)) {}
+
+    byte_buffer(byte_buffer&& o) noexcept
+        : data_(std::exchange(o.data_, nullptr)),
+          size_(std::exchange(o.size_, 0)),
+          capacity_(std::exchange(o.capacity_, 0)) {}
+
+    byte_buffer& operator=(const byte_buffer& o) {
+        if (this != &o) {
+            byte_buffer tmp(o);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    byte_buffer& operator=(byte_buffer&& o) noexcept {
+        if (this != &o) {
+            deallocate(data_);
+            data_ = std::exchange(o.data_, nullptr);
+            size_ = std::exchange(o.size_, 0);
+            capacity_ = std::exchange(o.capacity_, 0);
+        }
+        return *this;
+    }
+
+    ~byte_buffer() { deallocate(data_); }
+
+    /**
+     * @brief Buffer sizeof(IntT) byte dari integer dengan target endian
+     * @note Sama seperti bytes<N>::from_int(value, target_endian)
+     */
+    template <typename IntT>
+    requires std::is_integral_v<IntT>
+    [[nodiscard]] static byte_buffer from_int(IntT value, endian_t target_endian) {
+        byte_buffer r(sizeof(IntT));
+        for (size_type i = 0; i < sizeof(IntT); ++i)
+            r.data_[i] = static_cast<byte_t>(static_cast<std::make_unsigned_t<IntT>>(value) >> (i * 8));
+        if (target_endian != native_endian) r.swap_bytes();
+        return r;
+    }
+
+    // ============= Element Access =============
+
+    [[nodiscard]] reference operator[](size_type i) noexcept { return data_[i]; }
+    [[nodiscard]] const_reference operator[](size_type i) const noexcept { return data_[i]; }
+    [[nodiscard]] pointer data() noexcept { return data_; }
+    [[nodiscard]] const_pointer data() const noexcept { return data_; }
+
+    // ============= Capacity =============
+
+    [[nodiscard]] size_type size() const noexcept { return size_; }
+    [[nodiscard]] size_type capacity() const noexcept { return capacity_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    /** @brief Pastikan capacity >= n (data lama dipertahankan) */
+    void reserve(size_type n) {
+        if (n <= capacity_) return;
+        byte_t* fresh = allocate(n);
+        if (size_) std::memcpy(fresh, data_, size_);
+        deallocate(data_);
+        data_ = fresh;
+        capacity_ = n;
+    }
+
+    /** @brief Ubah ukuran; byte baru diisi fill_value */
+    void resize(size_type n, byte_t fill_value = 0) {
+        if (n > capacity_) reserve(n > capacity_ * 2 ? n : capacity_ * 2);
+        if (n > size_) std::memset(data_ + size_, fill_value, n - size_);
+        size_ = n;
+    }
+
+    // ============= Modifiers =============
+
+    void push_back(byte_t v) {
+        if (size_ == capacity_) reserve(capacity_ ? capacity_ * 2 : alignment);
+        data_[size_++] = v;
+    }
+
+    /** @brief Tambahkan byte dari view di akhir buffer */
+    void append(bytes_view v) {
+        if (v.empty()) return;
+        const size_type old = size_;
+        if (old + v.size() > capacity_) {
+            // v bisa merujuk ke buffer ini sendiri: salin dulu sebelum realloc
+            byte_buffer tmp(v);
+            resize(old + tmp.size());
+            std::memcpy(data_ + old, tmp.data_, tmp.size());
+        } else {
+            resize(old + v.size());
+            std::memmove(data_ + old, v.data(), v.size());
+        }
+    }
+
+    void swap(byte_buffer& o) noexcept {
+        std::swap(data_, o.data_);
+        std::swap(size_, o.size_);
+        std::swap(capacity_, o.capacity_);
+    }
+
+    // ============= Iterators =============
+
+    [[nodiscard]] pointer begin() noexcept { return data_; }
+    [[nodiscard]] pointer end() noexcept { return data_ + size_; }
+    [[nodiscard]] const_pointer begin() const noexcept { return data_; }
+    [[nodiscard]] const_pointer end() const noexcept { return data_ + size_; }
+
+    // ============= Views =============
+
+    [[nodiscard]] bytes_view view() const noexcept { return {data_, size_}; }
+    [[nodiscard]] mutable_bytes_view mutable_view() noexcept { return {data_, size_}; }
+
+    operator bytes_view() const noexcept { return view(); }
+    operator mutable_bytes_view() noexcept { return mutable_view(); }
+};
+
+// ============= Compound Assignment (out-of-line) =============
+
+template <typename Derived>
+Derived& detail::byte_span_mut_ops<Derived>::operator|=(bytes_view o) noexcept {
+    return apply<simd::bit_op::or_>(o.data(), o.size());
+}
+
+template <typename Derived>
+Derived& detail::byte_span_mut_ops<Derived>::operator&=(bytes_view o) noexcept {
+    return apply<simd::bit_op::and_>(o.data(), o.size());
+}
+
+template <typename Derived>
+Derived& detail::byte_span_mut_ops<Derived>::operator^=(bytes_view o) noexcept {
+    return apply<simd::bit_op::xor_>(o.data(), o.size());
+}
+
+// ============= Endian Conversion (out-of-line) =============
+
+template <typename Derived>
+byte_buffer detail::byte_span_ops<Derived>::to_endian(endian_t target) const {
+    byte_buffer r(bytes_view(ptr(), len()));
+    if (target != native_endian) r.swap_bytes();
+    return r;
+}
+
+template <typename Derived>
+byte_buffer detail::byte_span_ops<Derived>::from_endian(endian_t source) const {
+    return to_endian(source);
+}
+
+template <typename Derived>
+byte_buffer detail::byte_span_ops<Derived>::to_little_endian() const {
+    return to_endian(endian_t::little);
+}
+
+template <typename Derived>
+byte_buffer detail::byte_span_ops<Derived>::to_big_endian() const {
+    return to_endian(endian_t::big);
+}
+
+template <typename Derived>
+byte_buffer detail::byte_span_ops<Derived>::to_network() const {
+    return to_endian(endian_t::big);
+}
+
+template <typename Derived>
+byte_buffer detail::byte_span_ops<Derived>::from_little_endian() const {
+    return to_endian(endian_t::little);
+}
+
+template <typename Derived>
+byte_buffer detail::byte_span_ops<Derived>::from_big_endian() const {
+    return to_endian(endian_t::big);
+}
+
+template <typename Derived>
+byte_buffer detail::byte_span_ops<Derived>::from_network() const {
+    return to_endian(endian_t::big);
+}
+
+// ============= Binary Operators =============
+
+namespace detail {
+
+template <typename T>
+struct is_byte_span : std::false_type {};
+
+template <typename Byte>
+struct is_byte_span<basic_bytes_view<Byte>> : std::true_type {};
+
+template <>
+struct is_byte_span<byte_buffer> : std::true_type {};
+
+/**
+ * @brief Operand operator bebas: bytes_view, mutable_bytes_view, byte_buffer
+ * @note Tidak memakai konversi implisit, sehingga bytes<N> & bytes<M> tetap
+ *       tidak compile dan tidak diam-diam menjadi byte_buffer
+ */
+template <typename T>
+concept byte_span = is_byte_span<std::remove_cvref_t<T>>::value;
+
+} // namespace detail
+
+/** @brief a | b, hasil sepanjang a */
+template <detail::byte_span A, detail::byte_span B>
+[[nodiscard]] inline byte_buffer operator|(const A& a, const B& b) {
+    byte_buffer r{bytes_view(a)};
+    r |= bytes_view(b);
+    return r;
+}
+
+template <detail::byte_span A, detail::byte_span B>
+[[nodiscard]] inline byte_buffer operator&(const A& a, const B& b) {
+    byte_buffer r{bytes_view(a)};
+    r &= bytes_view(b);
+    return r;
+}
+
+template <detail::byte_span A, detail::byte_span B>
+[[nodiscard]] inline byte_buffer operator^(const A& a, const B& b) {
+    byte_buffer r{bytes_view(a)};
+    r ^= bytes_view(b);
+    return r;
+}
+
+template <detail::byte_span A>
+[[nodiscard]] inline byte_buffer operator~(const A& a) {
+    byte_buffer r{bytes_view(a)};
+    r.flip();
+    return r;
+}
+
+template <detail::byte_span A>
+[[nodiscard]] inline byte_buffer operator<<(const A& a, size_t bits) {
+    byte_buffer r{bytes_view(a)};
+    r <<= bits;
+    return r;
+}
+
+template <detail::byte_span A>
+[[nodiscard]] inline byte_buffer operator>>(const A& a, size_t bits) {
+    byte_buffer r{bytes_view(a)};
+    r >>= bits;
+    return r;
+}
+
+// ============= Comparison =============
+
+/** @brief Sama jika ukuran dan isi sama */
+template <detail::byte_span A, detail::byte_span B>
+[[nodiscard]] inline bool operator==(const A& x, const B& y) noexcept {
+    const bytes_view a(x), b(y);
+    return a.size() == b.size() && (a.empty() || std::memcmp(a.data(), b.data(), a.size()) == 0);
+}
+
+} // namespace zuu
@@ -6,17 +6,70 @@
  * @version 1.1.0
  * 
  * Container compile-time untuk manipulasi bit-level.
- * Dioptimasi untuk operasi bitwise dan cache efficiency.
+ * Dioptimasi untuk operasi bitwise dan cache efficiency: operator bitwise
+ * memakai kernel SIMD (simd.hpp) di runtime dan tetap constexpr.
+ *
+ * & | ^ ~ selalu mengembalikan bytes<N>. Fusi beberapa operator dalam satu
+ * pass bersifat opt-in lewat lazy(a) (bytes_expr.hpp).
  */
 
 #include "endian.hpp"
+#include "simd.hpp"
 #include <algorithm>
 #include <bit>
+#include <compare>
 #include <cstdint>
 #include <cstring>
+#include <iterator>
+#include <type_traits>
 
 namespace zuu {
 
+// ============= Order Policies =============
+
+/** @brief Urutan byte demi byte dari byte 0 (operator<=> bawaan bytes) */
+struct lexicographic_order {};
+
+/** @brief Urutan unsigned integer little-endian (byte N-1 paling signifikan) */
+struct numeric_order {};
+
+template <typename Order>
+concept bytes_order = std::is_same_v<Order, lexicographic_order> || std::is_same_v<Order, numeric_order>;
+
+/** @brief Ekspresi bitwise lazy bernilai N byte (lihat bytes_expr.hpp) */
+template <typename E, size_t N>
+concept bytes_expression = requires(const E& e, uint8_t* dst) {
+    e.eval_into(dst);
+    e.template apply_into<simd::bit_op::or_>(dst);
+} && E::byte_count == N;
+
+// ============= Word Helpers =============
+
+namespace detail {
+
+/** @brief Load 64-bit little-endian word (byte loop saat constant evaluation) */
+[[nodiscard]] constexpr uint64_t load_le64(const uint8_t* p) noexcept {
+    if (!std::is_constant_evaluated()) return from_little_endian(simd::load_u64(p));
+    uint64_t w = 0;
+    for (size_t j = 0; j < 8; ++j) w |= static_cast<uint64_t>(p[j]) << (j * 8);
+    return w;
+}
+
+/** @brief Store 64-bit little-endian word */
+inline void store_le64(uint8_t* p, uint64_t v) noexcept {
+    simd::store_u64(p, to_little_endian(v));
+}
+
+/** @brief Word ke-i dari p[0..n), bit 0 = bit 0 byte i*8 (tail di-pad nol) */
+[[nodiscard]] constexpr uint64_t word_at(const uint8_t* p, size_t n, size_t i) noexcept {
+    if ((i + 1) * 8 <= n) return load_le64(p + i * 8);
+    uint64_t w = 0;
+    for (size_t j = i * 8; j < n; ++j) w |= static_cast<uint64_t>(p[j]) << ((j - i * 8) * 8);
+    return w;
+}
+
+} // namespace detail
+
 /**
  * @brief Fixed-size byte array dengan operasi bitwise
  * @tparam N Jumlah byte (harus > 0)
@@ -42,10 +95,165 @@ public:
     static constexpr size_type byte_count = N;
     static constexpr size_type bit_count = N * 8;
 
+    /** @brief Jumlah limb 64-bit (limb terakhir di-pad nol jika N % 8 != 0) */
+    static constexpr size_type limb_count = (N + 7) / 8;
+
 private:
     alignas(N >= 16 ? 16 : (N >= 8 ? 8 : (N >= 4 ? 4 : 1))) 
     byte_t data_[N]{};
 
+    /**
+     * @brief Elementwise op: byte loop saat constant evaluation, word loop
+     *        untuk N kecil, kernel SIMD ter-dispatch untuk N besar
+     */
+    template <simd::bit_op Op>
+    static constexpr void bitwise(byte_t* dst, const byte_t* a, const byte_t* b) noexcept {
+        if (std::is_constant_evaluated()) {
+            for (size_type i = 0; i < N; ++i) dst[i] = simd::apply<Op>(a[i], b[i]);
+        } else if constexpr (N >= simd::dispatch_threshold) {
+            simd::bitwise<Op>(dst, a, b, N);
+        } else {
+            simd::bitwise_words<Op>(dst, a, b, N);
+        }
+    }
+
+    // ============= Limb Access =============
+
+    /** @brief Data sebagai limb 64-bit little-endian (limb 0 = bit 0..63) */
+    struct limbs_t {
+        uint64_t w[limb_count]{};
+
+        [[nodiscard]] constexpr uint64_t get(size_type i) const noexcept { return w[i]; }
+        constexpr void set(size_type i, uint64_t v) noexcept { w[i] = v; }
+    };
+
+    /**
+     * @brief Akses limb langsung ke storage (runtime, little-endian, N % 8 == 0)
+     *
+     * Menghindari salinan ke limbs_t: load/store 8 byte per limb langsung ke
+     * data_, sehingga shift berantai tidak terkena store-forwarding stall.
+     */
+    template <typename P>
+    struct limb_ref {
+        P p;
+
+        [[nodiscard]] uint64_t get(size_type i) const noexcept { return simd::load_u64(p + i * 8); }
+        void set(size_type i, uint64_t v) const noexcept { simd::store_u64(p + i * 8, v); }
+    };
+
+    /** @brief True jika limb_ref dapat dipakai (layout limb == layout byte) */
+    static constexpr bool direct_limbs = N % 8 == 0 && is_little_endian;
+
+    /** @brief Limb ke-i tanpa menyalin seluruh data (padding = 0) */
+    [[nodiscard]] constexpr uint64_t limb_at(size_type i) const noexcept {
+        return detail::word_at(data_, N, i);
+    }
+
+    /**
+     * @brief Byte [8i, 8i+8) sebagai word big-endian (byte 8i = bit 56..63)
+     * @note Word terakhir di-pad nol di bit bawah, urutan word = urutan byte
+     */
+    [[nodiscard]] constexpr uint64_t be_word_at(size_type i) const noexcept {
+        if (!std::is_constant_evaluated() && i < N / 8) {
+            return zuu::from_big_endian(simd::load_u64(data_ + i * 8));
+        }
+        uint64_t w = 0;
+        const size_type end = (i + 1) * 8 < N ? (i + 1) * 8 : N;
+        for (size_type j = i * 8; j < end; ++j)
+            w |= static_cast<uint64_t>(data_[j]) << ((7 - (j - i * 8)) * 8);
+        return w;
+    }
+
+    /** @brief Mask bit valid pada limb ke-i (limb terakhir bisa parsial) */
+    [[nodiscard]] static constexpr uint64_t limb_mask(size_type i) noexcept {
+        if constexpr (N % 8 == 0) {
+            return ~uint64_t{0};
+        } else {
+            return i + 1 < limb_count ? ~uint64_t{0} : (uint64_t{1} << ((N % 8) * 8)) - 1;
+        }
+    }
+
+    [[nodiscard]] constexpr limbs_t load_limbs() const noexcept {
+        limbs_t l{};
+        if (std::is_constant_evaluated() || !is_little_endian) {
+            for (size_type i = 0; i < N; ++i)
+                l.w[i / 8] |= static_cast<uint64_t>(data_[i]) << ((i % 8) * 8);
+        } else {
+            std::memcpy(l.w, data_, N);
+        }
+        return l;
+    }
+
+    /** @brief Simpan limb; bit di atas bit_count dibuang */
+    constexpr void store_limbs(const limbs_t& l) noexcept {
+        if (std::is_constant_evaluated() || !is_little_endian) {
+            for (size_type i = 0; i < N; ++i)
+                data_[i] = static_cast<byte_t>(l.w[i / 8] >> ((i % 8) * 8));
+        } else {
+            std::memcpy(data_, l.w, N);
+        }
+    }
+
+    /** @brief (hi:lo) << s, ambil 64 bit atas; s < 64 */
+    [[nodiscard]] static constexpr uint64_t funnel_shl(uint64_t hi, uint64_t lo, unsigned s) noexcept {
+        return s == 0 ? hi : (hi << s) | (lo >> (64 - s));
+    }
+
+    /** @brief (hi:lo) >> s, ambil 64 bit bawah; s < 64 */
+    [[nodiscard]] static constexpr uint64_t funnel_shr(uint64_t hi, uint64_t lo, unsigned s) noexcept {
+        return s == 0 ? lo : (lo >> s) | (hi << (64 - s));
+    }
+
+    /** @brief Balik urutan 64 bit: bswap lalu tukar nibble, pasangan, dan bit per byte */
+    [[nodiscard]] static constexpr uint64_t reverse_bits64(uint64_t x) noexcept {
+        x = detail::bswap64(x);
+        x = ((x >> 4) & 0x0F0F0F0F0F0F0F0Full) | ((x & 0x0F0F0F0F0F0F0F0Full) << 4);
+        x = ((x >> 2) & 0x3333333333333333ull) | ((x & 0x3333333333333333ull) << 2);
+        return ((x >> 1) & 0x5555555555555555ull) | ((x & 0x5555555555555555ull) << 1);
+    }
+
+    /** @brief Shift left in-place, bits < limb_count * 64 */
+    template <typename L>
+    static constexpr void shl_limbs(L&& l, size_type bits) noexcept {
+        const size_type ws = bits / 64;
+        const unsigned bs = static_cast<unsigned>(bits % 64);
+        for (size_type i = limb_count; i-- > 0;) {
+            if (i < ws) {
+                l.set(i, 0);
+            } else {
+                const uint64_t lo = i > ws ? l.get(i - ws - 1) : 0;
+                l.set(i, funnel_shl(l.get(i - ws), lo, bs));
+            }
+        }
+    }
+
+    /** @brief Shift right in-place, bits < limb_count * 64 */
+    template <typename L>
+    static constexpr void shr_limbs(L&& l, size_type bits) noexcept {
+        const size_type ws = bits / 64;
+        const unsigned bs = static_cast<unsigned>(bits % 64);
+        for (size_type i = 0; i < limb_count; ++i) {
+            if (i + ws >= limb_count) {
+                l.set(i, 0);
+            } else {
+                const uint64_t hi = i + ws + 1 < limb_count ? l.get(i + ws + 1) : 0;
+                l.set(i, funnel_shr(hi, l.get(i + ws), bs));
+            }
+        }
+    }
+
+    /** @brief Rotate left (N % 8 == 0): satu funnel shift per limb output */
+    template <typename Src, typename Dst>
+    static constexpr void rotl_limbs(const Src& src, Dst&& dst, size_type n) noexcept {
+        const size_type ws = n / 64;
+        const unsigned bs = static_cast<unsigned>(n % 64);
+        for (size_type i = 0; i < limb_count; ++i) {
+            const uint64_t hi = src.get((i + limb_count - ws) % limb_count);
+            const uint64_t lo = src.get((i + limb_count - ws - 1) % limb_count);
+            dst.set(i, funnel_shl(hi, lo, bs));
+        }
+    }
+
 public:
     // ============= Constructors =============
     
@@ -71,7 +279,10 @@ public:
     requires std::is_integral_v<IntT>
     constexpr explicit bytes(IntT value) noexcept {
         constexpr size_type copy = sizeof(IntT) < N ? sizeof(IntT) : N;
-        if constexpr (copy <= 8) {
+        if (!std::is_constant_evaluated() && is_little_endian) {
+            // Satu store lebar: load 64-bit berikutnya bisa store-forwarding
+            std::memcpy(data_, &value, copy);
+        } else if constexpr (copy <= 8) {
             for (size_type i = 0; i < copy; ++i) {
                 data_[i] = static_cast<byte_t>(value >> (i * 8));
             }
@@ -85,6 +296,17 @@ public:
         for (size_type i = 0; i < N; ++i) data_[i] = fill_value;
     }
 
+    /** @brief Evaluasi ekspresi lazy dalam satu pass */
+    template <bytes_expression<N> E>
+    constexpr bytes(const E& e) noexcept { e.eval_into(data_); }
+
+    /** @brief Evaluasi ekspresi langsung ke storage (boleh memuat *this) */
+    template <bytes_expression<N> E>
+    constexpr bytes& operator=(const E& e) noexcept {
+        e.eval_into(data_);
+        return *this;
+    }
+
     // ============= Element Access =============
 
     [[nodiscard]] constexpr reference operator[](size_type i) noexcept { 
@@ -121,79 +343,105 @@ public:
 
     [[nodiscard]] constexpr bytes operator|(const bytes& o) const noexcept {
         bytes r;
-        for (size_type i = 0; i < N; ++i) r.data_[i] = data_[i] | o.data_[i];
+        bitwise<simd::bit_op::or_>(r.data_, data_, o.data_);
         return r;
     }
 
     [[nodiscard]] constexpr bytes operator&(const bytes& o) const noexcept {
         bytes r;
-        for (size_type i = 0; i < N; ++i) r.data_[i] = data_[i] & o.data_[i];
+        bitwise<simd::bit_op::and_>(r.data_, data_, o.data_);
         return r;
     }
 
     [[nodiscard]] constexpr bytes operator^(const bytes& o) const noexcept {
         bytes r;
-        for (size_type i = 0; i < N; ++i) r.data_[i] = data_[i] ^ o.data_[i];
+        bitwise<simd::bit_op::xor_>(r.data_, data_, o.data_);
         return r;
     }
 
     [[nodiscard]] constexpr bytes operator~() const noexcept {
         bytes r;
-        for (size_type i = 0; i < N; ++i) r.data_[i] = ~data_[i];
+        bitwise<simd::bit_op::not_>(r.data_, data_, data_);
         return r;
     }
 
     // ============= Shift Operations =============
 
     [[nodiscard]] constexpr bytes operator<<(size_type bits) const noexcept {
-        if (bits == 0) return *this;
-        if (bits >= bit_count) return bytes{};
-        
-        bytes r;
-        const size_type byte_sh = bits / 8;
-        const size_type bit_sh = bits % 8;
-
-        if (bit_sh == 0) {
-            for (size_type i = byte_sh; i < N; ++i) 
-                r.data_[i] = data_[i - byte_sh];
-        } else {
-            byte_t carry = 0;
-            for (size_type i = 0; i < N - byte_sh; ++i) {
-                r.data_[i + byte_sh] = (data_[i] << bit_sh) | carry;
-                carry = data_[i] >> (8 - bit_sh);
-            }
-        }
+        bytes r = *this;
+        r <<= bits;
         return r;
     }
 
     [[nodiscard]] constexpr bytes operator>>(size_type bits) const noexcept {
-        if (bits == 0) return *this;
-        if (bits >= bit_count) return bytes{};
-        
-        bytes r;
-        const size_type byte_sh = bits / 8;
-        const size_type bit_sh = bits % 8;
-
-        if (bit_sh == 0) {
-            for (size_type i = 0; i < N - byte_sh; ++i) 
-                r.data_[i] = data_[i + byte_sh];
-        } else {
-            byte_t carry = 0;
-            for (size_type i = N - byte_sh; i-- > 0;) {
-                r.data_[i] = (data_[i + byte_sh] >> bit_sh) | carry;
-                carry = data_[i + byte_sh] << (8 - bit_sh);
-            }
-        }
+        bytes r = *this;
+        r >>= bits;
         return r;
     }
 
     // ============= Compound Assignment =============
 
-    constexpr bytes& operator|=(const bytes& o) noexcept { return *this = *this | o; }
-    constexpr bytes& operator&=(const bytes& o) noexcept { return *this = *this & o; }
-    constexpr bytes& operator^=(const bytes& o) noexcept { return *this = *this ^ o; }
-    constexpr bytes& operator<<=(size_type n) noexcept { return *this = *this << n; }
-    constexpr bytes& operator>>=(size_type n) noexcept { return *this = *this >> n; }
+    constexpr bytes& operator|=(const bytes& o) noexcept {
+        bitwise<simd::bit_op::or_>(data_, data_, o.data_);
+        return *this;
+    }
+    constexpr bytes& operator&=(const bytes& o) noexcept {
+        bitwise<simd::bit_op::and_>(data_, data_, o.data_);
+        return *this;
+    }
+    constexpr bytes& operator^=(const bytes& o) noexcept {
+        bitwise<simd::bit_op::xor_>(data_, data_, o.data_);
+        return *this;
+    }
+
+    /** @brief *this op= e dalam satu pass (tanpa mematerialisasi e) */
+    template <bytes_expression<N> E>
+    constexpr bytes& operator|=(const E& e) noexcept {
+        e.template apply_into<simd::bit_op::or_>(data_);
+        return *this;
+    }
+    template <bytes_expression<N> E>
+    constexpr bytes& operator&=(const E& e) noexcept {
+        e.template apply_into<simd::bit_op::and_>(data_);
+        return *this;
+    }
+    template <bytes_expression<N> E>
+    constexpr bytes& operator^=(const E& e) noexcept {
+        e.template apply_into<simd::bit_op::xor_>(data_);
+        return *this;
+    }
+
+    /** @brief Shift left in-place (per 64-bit limb, tanpa temporary bytes) */
+    constexpr bytes& operator<<=(size_type bits) noexcept {
+        if (bits == 0) return *this;
+        if (bits >= bit_count) { clear(); return *this; }
+        if constexpr (direct_limbs) {
+            if (!std::is_constant_evaluated()) {
+                shl_limbs(limb_ref<byte_t*>{data_}, bits);
+                return *this;
+            }
+        }
+        limbs_t l = load_limbs();
+        shl_limbs(l, bits);
+        store_limbs(l);
+        return *this;
+    }
+
+    /** @brief Shift right in-place (per 64-bit limb, tanpa temporary bytes) */
+    constexpr bytes& operator>>=(size_type bits) noexcept {
+        if (bits == 0) return *this;
+        if (bits >= bit_count) { clear(); return *this; }
+        if constexpr (direct_limbs) {
+            if (!std::is_constant_evaluated()) {
+                shr_limbs(limb_ref<byte_t*>{data_}, bits);
+                return *this;
+            }
+        }
+        limbs_t l = load_limbs();
+        shr_limbs(l, bits);
+        store_limbs(l);
+        return *this;
+    }
 
     // ============= Bit Manipulation =============
 
@@ -214,25 +462,229 @@ public:
     }
 
     [[nodiscard]] constexpr size_type popcount() const noexcept {
+        if constexpr (N >= simd::dispatch_threshold) {
+            if (!std::is_constant_evaluated()) return simd::popcount(data_, N);
+        }
         size_type c = 0;
         for (size_type i = 0; i < N; ++i) c += std::popcount(data_[i]);
         return c;
     }
 
+    // ============= Bit Search =============
+
+    /** @brief Nilai yang dikembalikan pencarian jika tidak ditemukan */
+    static constexpr size_type npos = bit_count;
+
+    /** @brief Jumlah bit nol berurutan dari bit 0 (bit_count jika semua nol) */
+    [[nodiscard]] constexpr size_type countr_zero() const noexcept {
+        for (size_type i = 0; i < limb_count; ++i) {
+            const uint64_t w = limb_at(i);
+            if (w != 0) return i * 64 + static_cast<size_type>(std::countr_zero(w));
+        }
+        return bit_count;
+    }
+
+    /** @brief Jumlah bit nol berurutan dari bit tertinggi (bit_count jika semua nol) */
+    [[nodiscard]] constexpr size_type countl_zero() const noexcept {
+        for (size_type i = limb_count; i-- > 0;) {
+            const uint64_t w = limb_at(i);
+            if (w != 0) {
+                const size_type top = i * 64 + 63 - static_cast<size_type>(std::countl_zero(w));
+                return bit_count - 1 - top;
+            }
+        }
+        return bit_count;
+    }
+
+    /** @brief Posisi bit set terendah, npos jika tidak ada */
+    [[nodiscard]] constexpr size_type find_first_set() const noexcept { return countr_zero(); }
+
+    /** @brief Posisi bit set pertama setelah pos (> pos), npos jika tidak ada */
+    [[nodiscard]] constexpr size_type find_next_set(size_type pos) const noexcept {
+        if (++pos >= bit_count) return npos;
+        size_type i = pos / 64;
+        uint64_t w = limb_at(i) & (~uint64_t{0} << (pos % 64));
+        while (w == 0) {
+            if (++i == limb_count) return npos;
+            w = limb_at(i);
+        }
+        return i * 64 + static_cast<size_type>(std::countr_zero(w));
+    }
+
+    /** @brief Posisi bit clear terendah, npos jika semua set */
+    [[nodiscard]] constexpr size_type find_first_clear() const noexcept {
+        for (size_type i = 0; i < limb_count; ++i) {
+            const uint64_t w = ~limb_at(i) & limb_mask(i);
+            if (w != 0) return i * 64 + static_cast<size_type>(std::countr_zero(w));
+        }
+        return npos;
+    }
+
+    /** @brief Posisi bit clear pertama setelah pos (> pos), npos jika tidak ada */
+    [[nodiscard]] constexpr size_type find_next_clear(size_type pos) const noexcept {
+        if (++pos >= bit_count) return npos;
+        size_type i = pos / 64;
+        uint64_t w = ~limb_at(i) & limb_mask(i) & (~uint64_t{0} << (pos % 64));
+        while (w == 0) {
+            if (++i == limb_count) return npos;
+            w = ~limb_at(i) & limb_mask(i);
+        }
+        return i * 64 + static_cast<size_type>(std::countr_zero(w));
+    }
+
+    /**
+     * @brief Forward iterator atas posisi bit set (ascending)
+     *
+     * Menyimpan limb aktif dan menghapus bit terendah tiap increment
+     * (w &= w - 1), sehingga biaya per bit set O(1) ditambah satu load per limb.
+     */
+    class set_bit_iterator {
+        const bytes* owner_ = nullptr;
+        size_type limb_ = limb_count;
+        uint64_t word_ = 0;
+
+        constexpr void skip_empty() noexcept {
+            while (word_ == 0 && ++limb_ < limb_count) word_ = owner_->limb_at(limb_);
+        }
+
+    public:
+        using value_type = size_type;
+        using difference_type = std::ptrdiff_t;
+        using iterator_category = std::forward_iterator_tag;
+
+        constexpr set_bit_iterator() noexcept = default;
+
+        constexpr explicit set_bit_iterator(const bytes& owner) noexcept
+            : owner_(&owner), limb_(0), word_(owner.limb_at(0)) {
+            skip_empty();
+        }
+
+        [[nodiscard]] constexpr size_type operator*() const noexcept {
+            return limb_ * 64 + static_cast<size_type>(std::countr_zero(word_));
+        }
+
+        constexpr set_bit_iterator& operator++() noexcept {
+            word_ &= word_ - 1;
+            skip_empty();
+            return *this;
+        }
+
+        constexpr set_bit_iterator operator++(int) noexcept {
+            set_bit_iterator tmp = *this;
+            ++*this;
+            return tmp;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const set_bit_iterator& o) const noexcept {
+            return limb_ == o.limb_ && word_ == o.word_;
+        }
+    };
+
+    /** @brief Range posisi bit set: for (size_t pos : b.set_bits()) */
+    struct set_bit_range {
+        const bytes* owner;
+
+        [[nodiscard]] constexpr set_bit_iterator begin() const noexcept { return set_bit_iterator(*owner); }
+        [[nodiscard]] constexpr set_bit_iterator end() const noexcept { return {}; }
+    };
+
+    [[nodiscard]] constexpr set_bit_range set_bits() const noexcept { return {this}; }
+
+    // ============= Bit Gather / Scatter =============
+
+    /**
+     * @brief Kumpulkan bit pada posisi set di mask ke bit rendah (pext)
+     * @return popcount(mask) bit terendah berisi bit terpilih (urutan naik),
+     *         sisanya nol
+     * @note BMI2 pext per limb jika cepat di CPU ini, selain itu fallback
+     *       per run bit (Zen1/Zen2 mengeksekusi pext/pdep via microcode)
+     */
+    [[nodiscard]] constexpr bytes extract_bits(const bytes& mask) const noexcept {
+        const limbs_t x = load_limbs();
+        const limbs_t m = mask.load_limbs();
+        limbs_t r{};
+        if (std::is_constant_evaluated()) {
+            simd::detail::extract_limbs_soft(x.w, m.w, r.w, limb_count);
+        } else {
+            simd::extract_bits(x.w, m.w, r.w, limb_count);
+        }
+        bytes out;
+        out.store_limbs(r);
+        return out;
+    }
+
+    /**
+     * @brief Sebar bit rendah ke posisi set di mask (pdep)
+     * @return Bit ke-k dari *this ditaruh di bit set ke-k dari mask
+     */
+    [[nodiscard]] constexpr bytes deposit_bits(const bytes& mask) const noexcept {
+        const limbs_t x = load_limbs();
+        const limbs_t m = mask.load_limbs();
+        limbs_t r{};
+        if (std::is_constant_evaluated()) {
+            simd::detail::deposit_limbs_soft(x.w, m.w, r.w, limb_count);
+        } else {
+            simd::deposit_bits(x.w, m.w, r.w, limb_count);
+        }
+        bytes out;
+        out.store_limbs(r);
+        return out;
+    }
+
     // ============= Rotation =============
 
+    /**
+     * @brief Rotate left sejauh n bit
+     * @note Jika N kelipatan 8, setiap limb output adalah satu funnel shift
+     *       dari dua limb input (tanpa dua salinan shift penuh)
+     */
     [[nodiscard]] constexpr bytes rotate_left(size_type n) const noexcept {
         n %= bit_count;
-        return (*this << n) | (*this >> (bit_count - n));
+        if (n == 0) return *this;
+
+        bytes out;
+        if constexpr (direct_limbs) {
+            if (!std::is_constant_evaluated()) {
+                rotl_limbs(limb_ref<const byte_t*>{data_}, limb_ref<byte_t*>{out.data_}, n);
+                return out;
+            }
+        }
+
+        const limbs_t l = load_limbs();
+        limbs_t r{};
+        if constexpr (N % 8 == 0) {
+            rotl_limbs(l, r, n);
+        } else {
+            limbs_t lo = l;
+            r = l;
+            shl_limbs(r, n);
+            shr_limbs(lo, bit_count - n);
+            for (size_type i = 0; i < limb_count; ++i) r.w[i] |= lo.w[i];
+        }
+        out.store_limbs(r);
+        return out;
     }
 
     [[nodiscard]] constexpr bytes rotate_right(size_type n) const noexcept {
         n %= bit_count;
-        return (*this >> n) | (*this << (bit_count - n));
+        return n == 0 ? *this : rotate_left(bit_count - n);
     }
 
     // ============= Conversion =============
 
+    /** @brief Array limb 64-bit, limb 0 = bit 0..63 (native integer order) */
+    using limb_array = limbs_t;
+
+    /** @brief Salin data ke limb 64-bit (padding limb terakhir = 0) */
+    [[nodiscard]] constexpr limb_array to_limbs() const noexcept { return load_limbs(); }
+
+    /** @brief Buat dari limb 64-bit; bit di atas bit_count dibuang */
+    [[nodiscard]] static constexpr bytes from_limbs(const limb_array& l) noexcept {
+        bytes r;
+        r.store_limbs(l);
+        return r;
+    }
+
     template <typename IntT>
     requires std::is_integral_v<IntT>
     [[nodiscard]] constexpr IntT to_int() const noexcept {
@@ -258,6 +710,21 @@ public:
         return r;
     }
 
+    /**
+     * @brief Balik urutan bit: bit i -> bit (bit_count - 1 - i)
+     * @note Satu reverse_bits64 per limb; N % 8 != 0 diakhiri shift right
+     *       sebesar padding limb terakhir
+     */
+    [[nodiscard]] constexpr bytes reverse_bits() const noexcept {
+        const limbs_t l = load_limbs();
+        limbs_t r{};
+        for (size_type i = 0; i < limb_count; ++i) r.w[i] = reverse_bits64(l.w[limb_count - 1 - i]);
+        if constexpr (N % 8 != 0) shr_limbs(r, limb_count * 64 - bit_count);
+        bytes out;
+        out.store_limbs(r);
+        return out;
+    }
+
     // ============= Endian Conversion =============
 
     /**
@@ -423,11 +890,67 @@ public:
     // ============= Comparison =============
 
     [[nodiscard]] constexpr bool operator==(const bytes&) const noexcept = default;
-    [[nodiscard]] constexpr auto operator<=>(const bytes&) const noexcept = default;
+
+    /**
+     * @brief Bandingkan 64 bit per langkah, satu branch per word
+     * @tparam Order lexicographic_order (word big-endian dari byte 0) atau
+     *         numeric_order (limb little-endian dari limb teratas)
+     */
+    template <bytes_order Order = lexicographic_order>
+    [[nodiscard]] constexpr std::strong_ordering compare(const bytes& o) const noexcept {
+        if constexpr (std::is_same_v<Order, numeric_order>) {
+            for (size_type i = limb_count; i-- > 0;) {
+                const uint64_t x = limb_at(i), y = o.limb_at(i);
+                if (x != y) return x < y ? std::strong_ordering::less : std::strong_ordering::greater;
+            }
+        } else {
+            for (size_type i = 0; i < limb_count; ++i) {
+                const uint64_t x = be_word_at(i), y = o.be_word_at(i);
+                if (x != y) return x < y ? std::strong_ordering::less : std::strong_ordering::greater;
+            }
+        }
+        return std::strong_ordering::equal;
+    }
+
+    /** @brief Leksikografis per byte (word-at-a-time) */
+    [[nodiscard]] constexpr std::strong_ordering operator<=>(const bytes& o) const noexcept {
+        return compare<lexicographic_order>(o);
+    }
 };
 
+// ============= Comparators =============
+
+/**
+ * @brief Comparator "less" untuk container terurut / std::sort
+ * @tparam Order lexicographic_order atau numeric_order
+ *
+ * @example
+ * ```cpp
+ * std::map<bytes<16>, row, bytes_less<numeric_order>> index;
+ * std::sort(v.begin(), v.end(), numeric_compare{});
+ * ```
+ */
+template <bytes_order Order>
+struct bytes_less {
+    using order_type = Order;
+
+    template <size_t N>
+    [[nodiscard]] constexpr bool operator()(const bytes<N>& a, const bytes<N>& b) const noexcept {
+        return a.template compare<Order>(b) < 0;
+    }
+};
+
+/** @brief a < b sebagai unsigned integer little-endian */
+using numeric_compare = bytes_less<numeric_order>;
+
+/** @brief a < b per byte dari byte 0 (sama dengan operator<) */
+using lexicographic_compare = bytes_less<lexicographic_order>;
+
 // Deduction guide
 template <size_t N>
 bytes(const unsigned char (&)[N]) -> bytes<N>;
 
 } // namespace zuu
+
+// Ekspresi lazy opt-in (lazy(a) & b ...); butuh bytes<N> lengkap
+#include "bytes_expr.hpp"
@@ -0,0 +1,433 @@
+#pragma once
+
+/**
+ * @file bytes_expr.hpp
+ * @brief Expression template untuk operasi bitwise multi-operand pada bytes<N>
+ * @version 1.0.0
+ *
+ * Operator & | ^ ~ milik bytes<N> selalu eager (hasil bytes<N>). Fusi
+ * opt-in: lazy(a) membungkus lvalue bytes<N> sebagai leaf, dan operator
+ * yang melibatkan leaf atau bytes_expr menghasilkan bytes_expr, pohon
+ * operasi yang menyimpan pointer ke operand. Pohon dievaluasi dalam satu
+ * pass (per 16/32/64 byte, kernel SSE2/AVX2/AVX-512 dipilih sekali per tipe
+ * ekspresi) saat:
+ * - di-assign / dipakai untuk construct bytes<N>, atau eval()
+ * - dipakai di sisi kanan |= &= ^=
+ * - popcount() / popcount(e): dihitung langsung tanpa hasil antara
+ *
+ * Hanya bytes lvalue yang boleh menjadi operand: lazy(rvalue) di-delete
+ * dan bytes rvalue tidak cocok dengan operator ekspresi, sehingga pohon
+ * tidak pernah menunjuk temporary.
+ *
+ * @note Seperti expression template lain, `auto e = lazy(a) & b;` menyimpan
+ *       pointer ke a dan b: a dan b harus hidup selama e dipakai
+ *
+ * @example
+ * ```cpp
+ * bytes<4096> a, b, c, d;
+ * bytes<4096> r = (lazy(a) & b) | (lazy(c) ^ ~lazy(d)); // satu pass
+ * r &= lazy(a) | b;                                     // satu pass, baca r, a, b
+ * size_t n = popcount((lazy(a) & b) | c);               // tanpa materialisasi
+ * bytes<4096> e = a & b;                                // eager, seperti biasa
+ * ```
+ *
+ * @note Di-include otomatis oleh bytes.hpp
+ */
+
+#include "bytes.hpp"
+#include "simd.hpp"
+#include <bit>
+#include <cstdint>
+#include <type_traits>
+
+namespace zuu {
+
+template <simd::bit_op Op, typename L, typename R>
+class bytes_expr;
+
+/**
+ * @brief Leaf ekspresi lazy: pointer ke N byte (bytes<N> lvalue atau storage tujuan)
+ * @note Dibuat lewat lazy(b); di namespace zuu agar operator ditemukan lewat ADL
+ */
+template <size_t N>
+struct lazy_bytes {
+    static constexpr size_t byte_count = N;
+
+    const uint8_t* p;
+
+    [[nodiscard]] constexpr uint8_t byte(size_t i) const noexcept { return p[i]; }
+    [[nodiscard]] uint64_t word(size_t i) const noexcept { return simd::load_u64(p + i); }
+
+#ifdef ZUU_SIMD_X86
+    ZUU_TARGET("sse2") [[nodiscard]] __m128i v128(size_t i) const noexcept {
+        return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p + i));
+    }
+    ZUU_TARGET("avx2") [[nodiscard]] __m256i v256(size_t i) const noexcept {
+        return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i));
+    }
+    ZUU_TARGET("avx512f") [[nodiscard]] __m512i v512(size_t i) const noexcept {
+        return _mm512_loadu_si512(p + i);
+    }
+#endif
+};
+
+namespace detail::bexpr {
+
+/** @brief Operand kanan kosong untuk bit_op::not_ */
+struct none {};
+
+template <typename T>
+struct is_expr : std::false_type {};
+
+template <simd::bit_op Op, typename L, typename R>
+struct is_expr<bytes_expr<Op, L, R>> : std::true_type {};
+
+template <size_t N>
+struct is_expr<lazy_bytes<N>> : std::true_type {};
+
+template <typename T>
+struct is_bytes : std::false_type {};
+
+template <size_t N>
+struct is_bytes<bytes<N>> : std::true_type {};
+
+/** @brief Leaf dari lazy() atau bytes_expr (setelah remove_cvref) */
+template <typename T>
+concept node = is_expr<std::remove_cvref_t<T>>::value;
+
+/** @brief Operand ekspresi: node, atau bytes lvalue (disimpan sebagai pointer) */
+template <typename T>
+concept operand = node<T> || (is_bytes<std::remove_cvref_t<T>>::value && std::is_lvalue_reference_v<T>);
+
+/** @brief Minimal satu sisi node: bytes & bytes tetap memakai operator eager */
+template <typename L, typename R>
+concept operand_pair = operand<L> && operand<R> && (node<L> || node<R>) &&
+                       std::remove_cvref_t<L>::byte_count == std::remove_cvref_t<R>::byte_count;
+
+/** @brief Node pohon untuk operand: bytes -> lazy_bytes, node -> salinannya */
+template <typename T>
+using node_t = std::conditional_t<is_bytes<T>::value, lazy_bytes<T::byte_count>, T>;
+
+template <typename T>
+[[nodiscard]] constexpr node_t<T> as_node(const T& x) noexcept {
+    if constexpr (is_bytes<T>::value) return lazy_bytes<T::byte_count>{x.data()};
+    else return x;
+}
+
+template <simd::bit_op Op, typename L, typename R>
+[[nodiscard]] constexpr auto combine(const L& l, const R& r) noexcept {
+    return bytes_expr<Op, node_t<L>, node_t<R>>(as_node(l), as_node(r));
+}
+
+// ============= Vector Ops =============
+
+#ifdef ZUU_SIMD_X86
+
+template <simd::bit_op Op>
+ZUU_TARGET("sse2")
+[[nodiscard]] inline __m128i apply128(__m128i a, __m128i b) noexcept {
+    if constexpr (Op == simd::bit_op::or_) return _mm_or_si128(a, b);
+    else if constexpr (Op == simd::bit_op::and_) return _mm_and_si128(a, b);
+    else if constexpr (Op == simd::bit_op::xor_) return _mm_xor_si128(a, b);
+    else return _mm_xor_si128(a, _mm_set1_epi32(-1));
+}
+
+template <simd::bit_op Op>
+ZUU_TARGET("avx2")
+[[nodiscard]] inline __m256i apply256(__m256i a, __m256i b) noexcept {
+    if constexpr (Op == simd::bit_op::or_) return _mm256_or_si256(a, b);
+    else if constexpr (Op == simd::bit_op::and_) return _mm256_and_si256(a, b);
+    else if constexpr (Op == simd::bit_op::xor_) return _mm256_xor_si256(a, b);
+    else return _mm256_xor_si256(a, _mm256_set1_epi32(-1));
+}
+
+template <simd::bit_op Op>
+ZUU_TARGET("avx512f")
+[[nodiscard]] inline __m512i apply512(__m512i a, __m512i b) noexcept {
+    if constexpr (Op == simd::bit_op::or_) return _mm512_or_si512(a, b);
+    else if constexpr (Op == simd::bit_op::and_) return _mm512_and_si512(a, b);
+    else if constexpr (Op == simd::bit_op::xor_) return _mm512_xor_si512(a, b);
+    else return _mm512_xor_si512(a, _mm512_set1_epi32(-1));
+}
+
+#endif // ZUU_SIMD_X86
+
+// ============= Evaluation Kernels =============
+
+/** @brief dst[i..N) = e, per word lalu per byte */
+template <typename E>
+inline void assign_tail(uint8_t* dst, const E& e, size_t i) noexcept {
+    constexpr size_t N = E::byte_count;
+    for (; i + 8 <= N; i += 8) simd::store_u64(dst + i, e.word(i));
+    for (; i < N; ++i) dst[i] = e.byte(i);
+}
+
+template <typename E>
+using assign_fn = void (*)(uint8_t* dst, const E& e) noexcept;
+
+template <typename E>
+inline void assign_words(uint8_t* dst, const E& e) noexcept { assign_tail(dst, e, 0); }
+
+template <typename E>
+[[nodiscard]] inline size_t count_tail(const E& e, size_t i) noexcept {
+    constexpr size_t N = E::byte_count;
+    size_t c = 0;
+    for (; i + 8 <= N; i += 8) c += static_cast<size_t>(std::popcount(e.word(i)));
+    for (; i < N; ++i) c += static_cast<size_t>(std::popcount(e.byte(i)));
+    return c;
+}
+
+template <typename E>
+using count_fn = size_t (*)(const E& e) noexcept;
+
+template <typename E>
+[[nodiscard]] inline size_t count_words(const E& e) noexcept { return count_tail(e, 0); }
+
+#ifdef ZUU_SIMD_X86
+
+template <typename E>
+ZUU_TARGET("sse2")
+inline void assign_sse2(uint8_t* dst, const E& e) noexcept {
+    const E x = e;  // salinan lokal: pointer leaf tetap di register meski dst di-store
+    size_t i = 0;
+    for (; i + 16 <= E::byte_count; i += 16) _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), x.v128(i));
+    assign_tail(dst, x, i);
+}
+
+template <typename E>
+ZUU_TARGET("avx2")
+inline void assign_avx2(uint8_t* dst, const E& e) noexcept {
+    const E x = e;
+    size_t i = 0;
+    for (; i + 32 <= E::byte_count; i += 32) _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), x.v256(i));
+    assign_tail(dst, x, i);
+}
+
+template <typename E>
+ZUU_TARGET("avx512f")
+inline void assign_avx512(uint8_t* dst, const E& e) noexcept {
+    const E x = e;
+    size_t i = 0;
+    for (; i + 64 <= E::byte_count; i += 64) _mm512_storeu_si512(dst + i, x.v512(i));
+    assign_tail(dst, x, i);
+}
+
+template <typename E>
+ZUU_TARGET("popcnt")
+[[nodiscard]] inline size_t count_popcnt(const E& e) noexcept {
+    // 4 akumulator independen agar popcnt tidak terserialisasi
+    uint64_t c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+    size_t i = 0;
+    for (; i + 32 <= E::byte_count; i += 32) {
+        c0 += static_cast<uint64_t>(std::popcount(e.word(i)));
+        c1 += static_cast<uint64_t>(std::popcount(e.word(i + 8)));
+        c2 += static_cast<uint64_t>(std::popcount(e.word(i + 16)));
+        c3 += static_cast<uint64_t>(std::popcount(e.word(i + 24)));
+    }
+    return static_cast<size_t>(c0 + c1 + c2 + c3) + count_tail(e, i);
+}
+
+/** @brief Popcount per nibble via pshufb, dijumlah per 64-bit dengan psadbw */
+template <typename E>
+ZUU_TARGET("avx2")
+[[nodiscard]] inline size_t count_avx2(const E& e) noexcept {
+    const __m256i lut = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                         0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low = _mm256_set1_epi8(0x0F);
+    __m256i acc = _mm256_setzero_si256();
+    size_t i = 0;
+    for (; i + 32 <= E::byte_count; i += 32) {
+        const __m256i v = e.v256(i);
+        const __m256i n = _mm256_add_epi8(_mm256_shuffle_epi8(lut, _mm256_and_si256(v, low)),
+                                          _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(v, 4), low)));
+        acc = _mm256_add_epi64(acc, _mm256_sad_epu8(n, _mm256_setzero_si256()));
+    }
+    alignas(32) uint64_t lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+    return static_cast<size_t>(lanes[0] + lanes[1] + lanes[2] + lanes[3]) + count_tail(e, i);
+}
+
+template <typename E>
+ZUU_TARGET("avx512f,avx512vpopcntdq")
+[[nodiscard]] inline size_t count_avx512(const E& e) noexcept {
+    __m512i acc = _mm512_setzero_si512();
+    size_t i = 0;
+    for (; i + 64 <= E::byte_count; i += 64) acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(e.v512(i)));
+    alignas(64) uint64_t lanes[8];
+    _mm512_store_si512(lanes, acc);
+    uint64_t c = 0;
+    for (uint64_t v : lanes) c += v;
+    return static_cast<size_t>(c) + count_tail(e, i);
+}
+
+#endif // ZUU_SIMD_X86
+
+template <typename E>
+[[nodiscard]] inline assign_fn<E> select_assign() noexcept {
+#ifdef ZUU_SIMD_X86
+    const auto& f = simd::cpu();
+    if (f.avx512f) return &assign_avx512<E>;
+    if (f.avx2) return &assign_avx2<E>;
+    if (f.sse2) return &assign_sse2<E>;
+#endif
+    return &assign_words<E>;
+}
+
+template <typename E>
+[[nodiscard]] inline count_fn<E> select_count() noexcept {
+#ifdef ZUU_SIMD_X86
+    const auto& f = simd::cpu();
+    if (f.avx512vpopcntdq) return &count_avx512<E>;
+    if (f.avx2) return &count_avx2<E>;
+    if (f.popcnt) return &count_popcnt<E>;
+#endif
+    return &count_words<E>;
+}
+
+template <typename E>
+inline void assign(uint8_t* dst, const E& e) noexcept {
+    static const assign_fn<E> fn = select_assign<E>();
+    fn(dst, e);
+}
+
+template <typename E>
+[[nodiscard]] inline size_t count(const E& e) noexcept {
+    static const count_fn<E> fn = select_count<E>();
+    return fn(e);
+}
+
+} // namespace detail::bexpr
+
+// ============= Expression =============
+
+/**
+ * @brief Node lazy: L Op R (R = detail::bexpr::none untuk bit_op::not_)
+ *
+ * Operand disimpan by value: leaf berupa pointer (8 byte), sub-ekspresi
+ * berupa node; seluruh pohon inline ke satu loop saat dievaluasi.
+ */
+template <simd::bit_op Op, typename L, typename R>
+class bytes_expr {
+public:
+    static constexpr size_t byte_count = L::byte_count;
+
+private:
+    L l_;
+    [[no_unique_address]] R r_;
+
+public:
+    constexpr bytes_expr(L l, R r) noexcept : l_(l), r_(r) {}
+
+    // ============= Evaluation =============
+
+    /** @brief dst[0..N) = nilai ekspresi (dst boleh salah satu operand) */
+    constexpr void eval_into(uint8_t* dst) const noexcept {
+        if (std::is_constant_evaluated()) {
+            for (size_t i = 0; i < byte_count; ++i) dst[i] = byte(i);
+        } else {
+            detail::bexpr::assign(dst, *this);
+        }
+    }
+
+    /** @brief dst = dst Op2 ekspresi, satu pass */
+    template <simd::bit_op Op2>
+    constexpr void apply_into(uint8_t* dst) const noexcept {
+        bytes_expr<Op2, lazy_bytes<byte_count>, bytes_expr>(
+            lazy_bytes<byte_count>{dst}, *this).eval_into(dst);
+    }
+
+    [[nodiscard]] constexpr bytes<byte_count> eval() const noexcept { return bytes<byte_count>(*this); }
+
+    /** @brief Jumlah bit set tanpa mematerialisasi ekspresi */
+    [[nodiscard]] constexpr size_t popcount() const noexcept {
+        if (std::is_constant_evaluated()) {
+            size_t c = 0;
+            for (size_t i = 0; i < byte_count; ++i) c += static_cast<size_t>(std::popcount(byte(i)));
+            return c;
+        }
+        return detail::bexpr::count(*this);
+    }
+
+    [[nodiscard]] constexpr uint8_t operator[](size_t i) const noexcept { return byte(i); }
+
+    [[nodiscard]] constexpr bool test_bit(size_t pos) const noexcept {
+        return pos < byte_count * 8 && (byte(pos / 8) & (1u << (pos % 8))) != 0;
+    }
+
+    // ============= Kernel Access =============
+
+    [[nodiscard]] constexpr uint8_t byte(size_t i) const noexcept {
+        if constexpr (Op == simd::bit_op::not_) return static_cast<uint8_t>(~l_.byte(i));
+        else return simd::apply<Op>(l_.byte(i), r_.byte(i));
+    }
+
+    [[nodiscard]] uint64_t word(size_t i) const noexcept {
+        if constexpr (Op == simd::bit_op::not_) return ~l_.word(i);
+        else return simd::apply<Op>(l_.word(i), r_.word(i));
+    }
+
+#ifdef ZUU_SIMD_X86
+    ZUU_TARGET("sse2") [[nodiscard]] __m128i v128(size_t i) const noexcept {
+        if constexpr (Op == simd::bit_op::not_) return detail::bexpr::apply128<Op>(l_.v128(i), l_.v128(i));
+        else return detail::bexpr::apply128<Op>(l_.v128(i), r_.v128(i));
+    }
+    ZUU_TARGET("avx2") [[nodiscard]] __m256i v256(size_t i) const noexcept {
+        if constexpr (Op == simd::bit_op::not_) return detail::bexpr::apply256<Op>(l_.v256(i), l_.v256(i));
+        else return detail::bexpr::apply256<Op>(l_.v256(i), r_.v256(i));
+    }
+    ZUU_TARGET("avx512f") [[nodiscard]] __m512i v512(size_t i) const noexcept {
+        if constexpr (Op == simd::bit_op::not_) return detail::bexpr::apply512<Op>(l_.v512(i), l_.v512(i));
+        else return detail::bexpr::apply512<Op>(l_.v512(i), r_.v512(i));
+    }
+#endif
+};
+
+// ============= Entry Point =============
+
+/**
+ * @brief Leaf ekspresi lazy untuk b; operator dengan leaf ini ikut lazy
+ * @note b harus hidup selama ekspresi dipakai
+ */
+template <size_t N>
+[[nodiscard]] constexpr lazy_bytes<N> lazy(const bytes<N>& b) noexcept { return {b.data()}; }
+
+/** @brief Temporary akan mati sebelum ekspresi dievaluasi */
+template <size_t N>
+void lazy(const bytes<N>&&) = delete;
+
+// ============= Operators =============
+
+template <typename L, typename R>
+requires detail::bexpr::operand_pair<L&&, R&&>
+[[nodiscard]] constexpr auto operator|(L&& l, R&& r) noexcept {
+    return detail::bexpr::combine<simd::bit_op::or_>(l, r);
+}
+
+template <typename L, typename R>
+requires detail::bexpr::operand_pair<L&&, R&&>
+[[nodiscard]] constexpr auto operator&(L&& l, R&& r) noexcept {
+    return detail::bexpr::combine<simd::bit_op::and_>(l, r);
+}
+
+template <typename L, typename R>
+requires detail::bexpr::operand_pair<L&&, R&&>
+[[nodiscard]] constexpr auto operator^(L&& l, R&& r) noexcept {
+    return detail::bexpr::combine<simd::bit_op::xor_>(l, r);
+}
+
+template <typename T>
+requires detail::bexpr::node<T>
+[[nodiscard]] constexpr auto operator~(const T& x) noexcept {
+    return bytes_expr<simd::bit_op::not_, T, detail::bexpr::none>(x, {});
+}
+
+// ============= Popcount =============
+
+/** @brief Jumlah bit set; untuk ekspresi dihitung tanpa hasil antara */
+template <size_t N>
+[[nodiscard]] constexpr size_t popcount(const bytes<N>& b) noexcept { return b.popcount(); }
+
+template <simd::bit_op Op, typename L, typename R>
+[[nodiscard]] constexpr size_t popcount(const bytes_expr<Op, L, R>& e) noexcept { return e.popcount(); }
+
+} // namespace zuu
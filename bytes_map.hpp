@@ -0,0 +1,536 @@
+#pragma once
+
+/**
+ * @file bytes_map.hpp
+ * @brief Flat hash map (gaya SwissTable) dengan key bytes<N>
+ * @version 1.0.0
+ *
+ * Open addressing dengan satu byte metadata (control byte) per slot. Probe
+ * membaca 16 control byte sekaligus (SSE2 pcmpeqb + pmovmskb) dan hanya
+ * membandingkan key pada slot yang 7 bit hash-nya cocok. Key dibandingkan
+ * per 16 byte dengan instruksi vektor (bytes<16> = satu compare).
+ *
+ * Memory layout (satu alokasi, aligned 64 byte):
+ * - capacity + 16 control byte (16 terakhir = salinan 16 pertama, agar load
+ *   grup di ujung tabel tidak perlu wrap-around)
+ * - capacity slot { bytes<N> key; V value; }
+ *
+ * @note Capacity selalu power of two; load factor maksimum 7/8. Rehash
+ *       memindahkan entry tanpa membandingkan key (semua key unik)
+ *
+ * @example
+ * ```cpp
+ * bytes_map<16, uint64_t> m;
+ * m.reserve(100'000'000);                 // satu alokasi, tanpa rehash
+ * m.try_emplace(uuid, 42);
+ * if (uint64_t* v = m.find(uuid)) ++*v;
+ * m[uuid] += 1;
+ * m.erase(uuid);
+ * ```
+ */
+
+#include "bytes.hpp"
+#include "simd.hpp"
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace zuu {
+
+// ============= Hashing =============
+
+namespace detail::flat {
+
+/** @brief 64x64 -> 128 bit, dilipat jadi 64 bit (hi ^ lo) */
+[[nodiscard]] inline uint64_t mum(uint64_t a, uint64_t b) noexcept {
+#ifdef __SIZEOF_INT128__
+    const unsigned __int128 p = static_cast<unsigned __int128>(a) * b;
+    return static_cast<uint64_t>(p) ^ static_cast<uint64_t>(p >> 64);
+#else
+    const uint64_t a0 = a & 0xFFFFFFFFu, a1 = a >> 32;
+    const uint64_t b0 = b & 0xFFFFFFFFu, b1 = b >> 32;
+    const uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+    const uint64_t mid = (p00 >> 32) + (p01 & 0xFFFFFFFFu) + (p10 & 0xFFFFFFFFu);
+    const uint64_t hi = p11 + (p01 >> 32) + (p10 >> 32) + (mid >> 32);
+    return ((mid << 32) | (p00 & 0xFFFFFFFFu)) ^ hi;
+#endif
+}
+
+inline constexpr uint64_t k0 = 0xA0761D6478BD642Full;
+inline constexpr uint64_t k1 = 0xE7037ED1A0B428DBull;
+
+} // namespace detail::flat
+
+/**
+ * @brief Hash default untuk bytes<N>: multiply-fold per 16 byte
+ * @note Tidak tahan hash flooding; beri seed acak untuk key dari pihak luar
+ */
+template <size_t N>
+struct bytes_hash {
+    uint64_t seed = 0;
+
+    [[nodiscard]] uint64_t operator()(const bytes<N>& key) const noexcept {
+        using namespace detail::flat;
+        constexpr size_t words = (N + 7) / 8;
+        uint64_t h = seed ^ k0;
+        size_t i = 0;
+        for (; i + 2 <= words; i += 2) {
+            h = mum(detail::word_at(key.data(), N, i) ^ k1 ^ h, detail::word_at(key.data(), N, i + 1) ^ k0);
+        }
+        if (i < words) h = mum(detail::word_at(key.data(), N, i) ^ k1 ^ h, N ^ k0);
+        return mum(h ^ k1, N ^ k0);
+    }
+};
+
+namespace detail::flat {
+
+// ============= Control Bytes =============
+
+/** @brief Control byte: 0..127 = slot terisi (7 bit hash), sisanya marker */
+inline constexpr int8_t ctrl_empty = -128;   // 0x80
+inline constexpr int8_t ctrl_deleted = -2;   // 0xFE (tombstone)
+
+inline constexpr size_t group_width = 16;
+inline constexpr size_t min_capacity = group_width;
+
+[[nodiscard]] constexpr uint8_t h2(uint64_t h) noexcept { return static_cast<uint8_t>(h & 0x7F); }
+[[nodiscard]] constexpr uint64_t h1(uint64_t h) noexcept { return h >> 7; }
+
+/** @brief Jumlah slot yang boleh terisi untuk capacity (load factor 7/8) */
+[[nodiscard]] constexpr size_t max_load(size_t cap) noexcept { return cap - cap / 8; }
+
+/** @brief Capacity minimum (power of two) untuk n entry */
+[[nodiscard]] constexpr size_t capacity_for(size_t n) noexcept {
+    size_t need = n + (n + 6) / 7;   // n * 8/7, dibulatkan ke atas
+    return need <= min_capacity ? min_capacity : std::bit_ceil(need);
+}
+
+/**
+ * @brief 16 control byte: bitmask slot yang cocok (bit i = slot pos + i)
+ */
+struct group {
+#if defined(ZUU_SIMD_X86) && defined(__SSE2__)
+    __m128i ctrl;
+
+    explicit group(const int8_t* p) noexcept : ctrl(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))) {}
+
+    [[nodiscard]] uint32_t match(uint8_t h) const noexcept {
+        return static_cast<uint32_t>(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(static_cast<char>(h)))));
+    }
+
+    [[nodiscard]] uint32_t match_empty() const noexcept {
+        return static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(ctrl_empty))));
+    }
+
+    /** @brief Slot kosong atau tombstone (bit 7 set, lebih kecil dari sentinel -1) */
+    [[nodiscard]] uint32_t match_empty_or_deleted() const noexcept {
+        return static_cast<uint32_t>(_mm_movemask_epi8(ctrl));
+    }
+#else
+    int8_t ctrl[group_width];
+
+    explicit group(const int8_t* p) noexcept { std::memcpy(ctrl, p, group_width); }
+
+    [[nodiscard]] uint32_t match(uint8_t h) const noexcept {
+        uint32_t m = 0;
+        for (size_t i = 0; i < group_width; ++i) m |= static_cast<uint32_t>(ctrl[i] == static_cast<int8_t>(h)) << i;
+        return m;
+    }
+
+    [[nodiscard]] uint32_t match_empty() const noexcept {
+        uint32_t m = 0;
+        for (size_t i = 0; i < group_width; ++i) m |= static_cast<uint32_t>(ctrl[i] == ctrl_empty) << i;
+        return m;
+    }
+
+    [[nodiscard]] uint32_t match_empty_or_deleted() const noexcept {
+        uint32_t m = 0;
+        for (size_t i = 0; i < group_width; ++i) m |= static_cast<uint32_t>(ctrl[i] < 0) << i;
+        return m;
+    }
+#endif
+};
+
+/**
+ * @brief Urutan probe: grup ke-i berada di pos + 16 * i(i+1)/2 (triangular)
+ * @note Untuk capacity power of two, setiap grup dikunjungi tepat sekali
+ */
+class probe_seq {
+    size_t mask_;
+    size_t offset_;
+    size_t index_ = 0;
+
+public:
+    probe_seq(uint64_t hash, size_t mask) noexcept : mask_(mask), offset_(static_cast<size_t>(hash) & mask) {}
+
+    [[nodiscard]] size_t offset() const noexcept { return offset_; }
+    [[nodiscard]] size_t offset(size_t i) const noexcept { return (offset_ + i) & mask_; }
+
+    void next() noexcept {
+        index_ += group_width;
+        offset_ = (offset_ + index_) & mask_;
+    }
+};
+
+// ============= Key Compare =============
+
+/** @brief a == b untuk N byte: per 16 byte pcmpeqb, tail via memcmp */
+template <size_t N>
+[[nodiscard]] inline bool key_equal(const uint8_t* a, const uint8_t* b) noexcept {
+#if defined(ZUU_SIMD_X86) && defined(__SSE2__)
+    if constexpr (N >= 16) {
+        constexpr size_t full = N / 16 * 16;
+        __m128i acc = _mm_set1_epi8(-1);
+        for (size_t i = 0; i < full; i += 16) {
+            acc = _mm_and_si128(acc, _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i)),
+                                                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i))));
+        }
+        if (_mm_movemask_epi8(acc) != 0xFFFF) return false;
+        if constexpr (full == N) return true;
+        else return std::memcmp(a + full, b + full, N - full) == 0;
+    }
+#endif
+    return std::memcmp(a, b, N) == 0;
+}
+
+} // namespace detail::flat
+
+// ============= Flat Hash Map =============
+
+/**
+ * @brief Flat hash map: key bytes<N> -> V
+ * @tparam N    Panjang key dalam byte
+ * @tparam V    Tipe value (harus nothrow move constructible)
+ * @tparam Hash Callable bytes<N> -> uint64_t
+ *
+ * Pointer ke value stabil sampai rehash berikutnya (insert yang menambah
+ * capacity, reserve, rehash).
+ */
+template <size_t N, typename V, typename Hash = bytes_hash<N>>
+class bytes_map {
+    static_assert(std::is_nothrow_move_constructible_v<V>, "bytes_map value must be nothrow move constructible");
+
+public:
+    // ============= Type Aliases =============
+    using key_type = bytes<N>;
+    using mapped_type = V;
+    using hasher = Hash;
+    using size_type = size_t;
+
+    struct slot {
+        key_type key;
+        V value;
+    };
+
+    static constexpr size_type group_width = detail::flat::group_width;
+    static constexpr size_type alloc_align = 64;
+
+private:
+    int8_t* ctrl_ = nullptr;
+    slot* slots_ = nullptr;
+    size_type capacity_ = 0;   // 0 atau power of two >= 16
+    size_type size_ = 0;
+    size_type growth_left_ = 0;
+    [[no_unique_address]] Hash hash_{};
+
+    // ============= Allocation =============
+
+    [[nodiscard]] static size_type slots_offset(size_type cap) noexcept {
+        const size_type a = alignof(slot) > alloc_align ? alignof(slot) : alloc_align;
+        return (cap + group_width + a - 1) / a * a;
+    }
+
+    [[nodiscard]] static size_type alloc_bytes(size_type cap) noexcept {
+        return slots_offset(cap) + cap * sizeof(slot);
+    }
+
+    [[nodiscard]] static std::align_val_t alloc_alignment() noexcept {
+        return std::align_val_t{alignof(slot) > alloc_align ? alignof(slot) : alloc_align};
+    }
+
+    void allocate(size_type cap) {
+        auto* p = static_cast<uint8_t*>(::operator new(alloc_bytes(cap), alloc_alignment()));
+        ctrl_ = reinterpret_cast<int8_t*>(p);
+        slots_ = reinterpret_cast<slot*>(p + slots_offset(cap));
+        capacity_ = cap;
+        std::memset(ctrl_, static_cast<uint8_t>(detail::flat::ctrl_empty), cap + group_width);
+        growth_left_ = detail::flat::max_load(cap);
+    }
+
+    static void deallocate(int8_t* ctrl, size_type cap) noexcept {
+        if (ctrl) ::operator delete(ctrl, alloc_bytes(cap), alloc_alignment());
+    }
+
+    void destroy_values() noexcept {
+        if constexpr (!std::is_trivially_destructible_v<V>) {
+            for (size_type i = 0; i < capacity_; ++i) {
+                if (ctrl_[i] >= 0) slots_[i].value.~V();
+            }
+        }
+    }
+
+    void release() noexcept {
+        destroy_values();
+        deallocate(ctrl_, capacity_);
+        ctrl_ = nullptr;
+        slots_ = nullptr;
+        capacity_ = size_ = growth_left_ = 0;
+    }
+
+    // ============= Control Helpers =============
+
+    /** @brief Set control byte i (dan salinannya di ujung jika i < 16) */
+    void set_ctrl(size_type i, int8_t c) noexcept {
+        ctrl_[i] = c;
+        if (i < group_width) ctrl_[capacity_ + i] = c;
+    }
+
+    [[nodiscard]] size_type mask() const noexcept { return capacity_ - 1; }
+
+    /** @brief Slot kosong/tombstone pertama di urutan probe hash */
+    [[nodiscard]] size_type find_free(uint64_t hash) const noexcept {
+        detail::flat::probe_seq seq(detail::flat::h1(hash), mask());
+        while (true) {
+            const uint32_t m = detail::flat::group(ctrl_ + seq.offset()).match_empty_or_deleted();
+            if (m) return seq.offset(static_cast<size_type>(std::countr_zero(m)));
+            seq.next();
+        }
+    }
+
+    [[nodiscard]] size_type find_index(const key_type& key, uint64_t hash) const noexcept {
+        if (capacity_ == 0) return capacity_;
+        const uint8_t tag = detail::flat::h2(hash);
+        detail::flat::probe_seq seq(detail::flat::h1(hash), mask());
+        while (true) {
+            const detail::flat::group g(ctrl_ + seq.offset());
+            for (uint32_t m = g.match(tag); m; m &= m - 1) {
+                const size_type i = seq.offset(static_cast<size_type>(std::countr_zero(m)));
+                if (detail::flat::key_equal<N>(slots_[i].key.data(), key.data())) return i;
+            }
+            if (g.match_empty()) return capacity_;
+            seq.next();
+        }
+    }
+
+    /**
+     * @brief Pindahkan semua entry ke tabel baru berkapasitas cap
+     * @note Tanpa compare key; juga membersihkan tombstone
+     */
+    void resize(size_type cap) {
+        int8_t* old_ctrl = ctrl_;
+        slot* old_slots = slots_;
+        const size_type old_cap = capacity_;
+
+        allocate(cap);
+        for (size_type i = 0; i < old_cap; ++i) {
+            if (old_ctrl[i] < 0) continue;
+            slot& s = old_slots[i];
+            const uint64_t hash = hash_(s.key);
+            const size_type j = find_free(hash);
+            set_ctrl(j, static_cast<int8_t>(detail::flat::h2(hash)));
+            std::memcpy(&slots_[j].key, &s.key, sizeof(key_type));
+            ::new (static_cast<void*>(&slots_[j].value)) V(std::move(s.value));
+            s.value.~V();
+        }
+        growth_left_ -= size_;
+        deallocate(old_ctrl, old_cap);
+    }
+
+    /** @brief Pastikan ada satu slot kosong baru; tombstone banyak = rehash di tempat */
+    void prepare_insert() {
+        if (growth_left_ != 0) return;
+        if (capacity_ == 0) {
+            allocate(detail::flat::min_capacity);
+        } else if (size_ <= detail::flat::max_load(capacity_) / 2) {
+            resize(capacity_);
+        } else {
+            resize(capacity_ * 2);
+        }
+    }
+
+public:
+    // ============= Constructors =============
+
+    bytes_map() = default;
+
+    explicit bytes_map(size_type n, const Hash& hash = Hash{}) : hash_(hash) { reserve(n); }
+
+    bytes_map(const bytes_map& o) : hash_(o.hash_) {
+        if (o.size_ == 0) return;
+        reserve(o.size_);
+        o.for_each([this](const key_type& k, const V& v) { try_emplace(k, v); });
+    }
+
+    bytes_map(bytes_map&& o) noexcept
+        : ctrl_(std::exchange(o.ctrl_, nullptr)), slots_(std::exchange(o.slots_, nullptr)),
+          capacity_(std::exchange(o.capacity_, 0)), size_(std::exchange(o.size_, 0)),
+          growth_left_(std::exchange(o.growth_left_, 0)), hash_(std::move(o.hash_)) {}
+
+    bytes_map& operator=(const bytes_map& o) {
+        if (this != &o) {
+            bytes_map tmp(o);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    bytes_map& operator=(bytes_map&& o) noexcept {
+        if (this != &o) {
+            release();
+            bytes_map tmp(std::move(o));
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    ~bytes_map() { release(); }
+
+    void swap(bytes_map& o) noexcept {
+        std::swap(ctrl_, o.ctrl_);
+        std::swap(slots_, o.slots_);
+        std::swap(capacity_, o.capacity_);
+        std::swap(size_, o.size_);
+        std::swap(growth_left_, o.growth_left_);
+        std::swap(hash_, o.hash_);
+    }
+
+    // ============= Capacity =============
+
+    [[nodiscard]] size_type size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+    [[nodiscard]] size_type capacity() const noexcept { return capacity_; }
+
+    [[nodiscard]] float load_factor() const noexcept {
+        return capacity_ ? static_cast<float>(size_) / static_cast<float>(capacity_) : 0.0f;
+    }
+
+    [[nodiscard]] static constexpr float max_load_factor() noexcept { return 0.875f; }
+
+    /** @brief Byte yang dialokasikan (control + slot) */
+    [[nodiscard]] size_type memory_usage() const noexcept { return capacity_ ? alloc_bytes(capacity_) : 0; }
+
+    /** @brief Siapkan tempat untuk n entry tanpa rehash */
+    void reserve(size_type n) {
+        if (n <= size_ + growth_left_) return;
+        resize(detail::flat::capacity_for(n));
+    }
+
+    /**
+     * @brief Bangun ulang tabel dengan capacity minimal untuk max(n, size())
+     * @note rehash(0) memadatkan tabel dan membuang semua tombstone
+     */
+    void rehash(size_type n) {
+        if (n < size_) n = size_;
+        if (n == 0) {
+            release();
+            return;
+        }
+        resize(detail::flat::capacity_for(n));
+    }
+
+    // ============= Lookup =============
+
+    [[nodiscard]] V* find(const key_type& key) noexcept {
+        const size_type i = find_index(key, hash_(key));
+        return i == capacity_ ? nullptr : &slots_[i].value;
+    }
+
+    [[nodiscard]] const V* find(const key_type& key) const noexcept {
+        const size_type i = find_index(key, hash_(key));
+        return i == capacity_ ? nullptr : &slots_[i].value;
+    }
+
+    [[nodiscard]] bool contains(const key_type& key) const noexcept { return find(key) != nullptr; }
+
+    // ============= Modifiers =============
+
+    /**
+     * @brief Sisipkan (key, V(args...)) jika key belum ada
+     * @return {pointer ke value, true jika baru disisipkan}
+     */
+    template <typename... Args>
+    std::pair<V*, bool> try_emplace(const key_type& key, Args&&... args) {
+        const uint64_t hash = hash_(key);
+        size_type i = find_index(key, hash);
+        if (i != capacity_) return {&slots_[i].value, false};
+
+        prepare_insert();
+        i = find_free(hash);
+        ::new (static_cast<void*>(&slots_[i].value)) V(std::forward<Args>(args)...);
+        std::memcpy(&slots_[i].key, &key, sizeof(key_type));
+        if (ctrl_[i] == detail::flat::ctrl_empty) --growth_left_;
+        set_ctrl(i, static_cast<int8_t>(detail::flat::h2(hash)));
+        ++size_;
+        return {&slots_[i].value, true};
+    }
+
+    template <typename U>
+    std::pair<V*, bool> insert_or_assign(const key_type& key, U&& value) {
+        auto r = try_emplace(key, std::forward<U>(value));
+        if (!r.second) *r.first = std::forward<U>(value);
+        return r;
+    }
+
+    V& operator[](const key_type& key) { return *try_emplace(key).first; }
+
+    /** @return true jika key ada dan dihapus */
+    bool erase(const key_type& key) noexcept {
+        const size_type i = find_index(key, hash_(key));
+        if (i == capacity_) return false;
+        slots_[i].value.~V();
+        --size_;
+        // Jika grup sekitar slot pernah punya slot kosong, probe tidak pernah
+        // melewati slot ini sebagai grup penuh: boleh langsung kosong lagi
+        const size_type before = (i - group_width) & mask();
+        const uint32_t empty_after = detail::flat::group(ctrl_ + i).match_empty();
+        const uint32_t empty_before = detail::flat::group(ctrl_ + before).match_empty();
+        const bool was_never_full = empty_after && empty_before &&
+            static_cast<size_type>(std::countr_zero(empty_after)) +
+            static_cast<size_type>(std::countl_zero(empty_before << 16)) < group_width;
+        if (was_never_full) {
+            set_ctrl(i, detail::flat::ctrl_empty);
+            ++growth_left_;
+        } else {
+            set_ctrl(i, detail::flat::ctrl_deleted);
+        }
+        return true;
+    }
+
+    /** @brief Hapus semua entry, capacity tetap */
+    void clear() noexcept {
+        if (capacity_ == 0) return;
+        destroy_values();
+        std::memset(ctrl_, static_cast<uint8_t>(detail::flat::ctrl_empty), capacity_ + group_width);
+        size_ = 0;
+        growth_left_ = detail::flat::max_load(capacity_);
+    }
+
+    // ============= Iteration =============
+
+    /** @brief f(const key_type&, V&) untuk setiap entry (urutan slot) */
+    template <typename F>
+    void for_each(F&& f) {
+        for (size_type i = 0; i < capacity_; i += group_width) {
+            for (uint32_t m = ~detail::flat::group(ctrl_ + i).match_empty_or_deleted() & 0xFFFFu; m; m &= m - 1) {
+                slot& s = slots_[i + static_cast<size_type>(std::countr_zero(m))];
+                f(static_cast<const key_type&>(s.key), s.value);
+            }
+        }
+    }
+
+    template <typename F>
+    void for_each(F&& f) const {
+        for (size_type i = 0; i < capacity_; i += group_width) {
+            for (uint32_t m = ~detail::flat::group(ctrl_ + i).match_empty_or_deleted() & 0xFFFFu; m; m &= m - 1) {
+                const slot& s = slots_[i + static_cast<size_type>(std::countr_zero(m))];
+                f(s.key, s.value);
+            }
+        }
+    }
+};
+
+} // namespace zuu
@@ -0,0 +1,154 @@
+#pragma once
+
+/**
+ * @file constant_time.hpp
+ * @brief Perbandingan dan seleksi constant-time untuk bytes<N>
+ * @version 1.0.0
+ *
+ * Untuk token, MAC dan key: waktu eksekusi tidak bergantung pada isi data,
+ * hanya pada N. operator== dan operator<=> bawaan bytes berhenti pada byte
+ * pertama yang berbeda; fungsi di sini selalu membaca semua limb 64-bit dan
+ * mereduksi dengan XOR/OR (juga lebih cepat dari loop per byte).
+ *
+ * Menyediakan:
+ * - ct_equal, ct_is_zero (bool) dan ct_equal_mask, ct_is_zero_mask (mask)
+ * - ct_less: urutan numerik unsigned (sama dengan compare() di bigint.hpp)
+ * - ct_select(mask, a, b): a jika mask = ~0, b jika mask = 0
+ * - ct_mask(cond): bool -> mask tanpa branch
+ *
+ * @note Hasil melewati value barrier (asm kosong) agar compiler tidak
+ *       mengubah reduksi menjadi early-exit atau seleksi menjadi branch
+ *
+ * @example
+ * ```cpp
+ * bytes<32> expected = hmac(key, msg);
+ * if (!ct_equal(expected, received)) reject();
+ * auto k = ct_select(ct_mask(use_new), new_key, old_key);
+ * ```
+ */
+
+#include "bytes.hpp"
+#include "endian.hpp"
+#include "simd.hpp"
+#include <cstdint>
+#include <type_traits>
+
+namespace zuu {
+
+namespace detail::ct {
+
+/** @brief Sembunyikan nilai dari optimizer (no-op saat constant evaluation) */
+[[nodiscard]] constexpr uint64_t barrier(uint64_t v) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    if (!std::is_constant_evaluated()) __asm__("" : "+r"(v));
+#endif
+    return v;
+}
+
+/** @brief Kebalikan detail::word_at: simpan limb ke-i (limb terakhir parsial) */
+template <size_t N>
+constexpr void store_limb(bytes<N>& b, size_t i, uint64_t w) noexcept {
+    if (!std::is_constant_evaluated() && (i + 1) * 8 <= N) {
+        detail::store_le64(b.data() + i * 8, w);
+        return;
+    }
+    const size_t end = (i + 1) * 8 < N ? (i + 1) * 8 : N;
+    for (size_t j = i * 8; j < end; ++j) b.data()[j] = static_cast<uint8_t>(w >> ((j - i * 8) * 8));
+}
+
+/** @brief ~0 jika v == 0, selain itu 0 */
+[[nodiscard]] constexpr uint64_t zero_mask(uint64_t v) noexcept {
+    // (v | -v) punya bit 63 set tepat saat v != 0
+    return ((v | (0 - v)) >> 63) - 1;
+}
+
+} // namespace detail::ct
+
+// ============= Masks =============
+
+/** @brief true -> ~0, false -> 0 (tanpa branch) */
+[[nodiscard]] constexpr uint64_t ct_mask(bool cond) noexcept {
+    return 0 - detail::ct::barrier(static_cast<uint64_t>(cond));
+}
+
+/** @brief ~0 jika semua byte nol, selain itu 0 */
+template <size_t N>
+[[nodiscard]] constexpr uint64_t ct_is_zero_mask(const bytes<N>& a) noexcept {
+    uint64_t acc = 0;
+    for (size_t i = 0; i < bytes<N>::limb_count; ++i) acc |= detail::word_at(a.data(), N, i);
+    return detail::ct::zero_mask(detail::ct::barrier(acc));
+}
+
+/** @brief ~0 jika a == b, selain itu 0 */
+template <size_t N>
+[[nodiscard]] constexpr uint64_t ct_equal_mask(const bytes<N>& a, const bytes<N>& b) noexcept {
+    uint64_t acc = 0;
+    for (size_t i = 0; i < bytes<N>::limb_count; ++i) acc |= detail::word_at(a.data(), N, i) ^ detail::word_at(b.data(), N, i);
+    return detail::ct::zero_mask(detail::ct::barrier(acc));
+}
+
+/**
+ * @brief ~0 jika a < b sebagai unsigned integer 8N bit, selain itu 0
+ * @note Borrow dari a - b dihitung melalui semua limb tanpa early exit
+ */
+template <size_t N>
+[[nodiscard]] constexpr uint64_t ct_less_mask(const bytes<N>& a, const bytes<N>& b) noexcept {
+    uint64_t borrow = 0;
+    for (size_t i = 0; i < bytes<N>::limb_count; ++i) {
+        const uint64_t x = detail::word_at(a.data(), N, i);
+        const uint64_t y = detail::word_at(b.data(), N, i);
+        const uint64_t d = x - y - borrow;
+        borrow = ((~x & y) | (~(x ^ y) & d)) >> 63;
+    }
+    return 0 - detail::ct::barrier(borrow);
+}
+
+// ============= Predicates =============
+
+template <size_t N>
+[[nodiscard]] constexpr bool ct_is_zero(const bytes<N>& a) noexcept {
+    return (ct_is_zero_mask(a) & 1) != 0;
+}
+
+template <size_t N>
+[[nodiscard]] constexpr bool ct_equal(const bytes<N>& a, const bytes<N>& b) noexcept {
+    return (ct_equal_mask(a, b) & 1) != 0;
+}
+
+template <size_t N>
+[[nodiscard]] constexpr bool ct_less(const bytes<N>& a, const bytes<N>& b) noexcept {
+    return (ct_less_mask(a, b) & 1) != 0;
+}
+
+// ============= Selection =============
+
+/**
+ * @brief a jika mask = ~0, b jika mask = 0 (per limb: b ^ (mask & (a ^ b)))
+ * @note mask selain 0 / ~0 memilih per bit
+ */
+template <size_t N>
+[[nodiscard]] constexpr bytes<N> ct_select(uint64_t mask, const bytes<N>& a, const bytes<N>& b) noexcept {
+    mask = detail::ct::barrier(mask);
+    bytes<N> r;
+    for (size_t i = 0; i < bytes<N>::limb_count; ++i) {
+        const uint64_t x = detail::word_at(a.data(), N, i);
+        const uint64_t y = detail::word_at(b.data(), N, i);
+        detail::ct::store_limb(r, i, y ^ (mask & (x ^ y)));
+    }
+    return r;
+}
+
+/** @brief Tukar a dan b jika mask = ~0, tanpa branch */
+template <size_t N>
+constexpr void ct_swap(uint64_t mask, bytes<N>& a, bytes<N>& b) noexcept {
+    mask = detail::ct::barrier(mask);
+    for (size_t i = 0; i < bytes<N>::limb_count; ++i) {
+        const uint64_t x = detail::word_at(a.data(), N, i);
+        const uint64_t y = detail::word_at(b.data(), N, i);
+        const uint64_t t = mask & (x ^ y);
+        detail::ct::store_limb(a, i, x ^ t);
+        detail::ct::store_limb(b, i, y ^ t);
+    }
+}
+
+} // namespace zuu
@@ -0,0 +1,444 @@
+#pragma once
+
+/**
+ * @file crc.hpp
+ * @brief CRC32C, CRC32 dan CRC64 dengan akselerasi hardware
+ * @version 1.0.0
+ *
+ * Menyediakan:
+ * - crc_spec: CRC reflected dengan polinom, init dan xor_out konfigurable
+ *   (width 32 atau 64 bit)
+ * - crc32c: instruksi SSE4.2 crc32 dengan interleaving tiga aliran untuk
+ *   buffer besar (menyembunyikan latency 3 cycle)
+ * - CRC generik (crc32, crc64, spec apapun): folding PCLMULQDQ 4x128 bit
+ * - Fallback software slicing-by-8 (constexpr)
+ * - crc_engine untuk update incremental, crc_combine untuk menggabungkan
+ *   CRC dua buffer tanpa membaca ulang data
+ *
+ * Overload tersedia untuk std::span<const uint8_t>, bytes<N> dan composer<T>.
+ *
+ * @note Free function memakai konvensi zlib: crc32c(b, crc32c(a)) sama
+ *       dengan crc32c(a || b)
+ *
+ * @example
+ * ```cpp
+ * uint32_t c = crc32c(record);            // std::span<const uint8_t>
+ * c = crc32c(trailer, c);                 // lanjutkan
+ * uint64_t h = crc64(composer<Header>(hdr));
+ *
+ * crc_engine<crc32c_spec> e;
+ * for (auto& frame : frames) e.update(frame);
+ * uint32_t total = e.value();
+ * ```
+ */
+
+#include "bytes.hpp"
+#include "composer.hpp"
+#include "simd.hpp"
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <type_traits>
+
+namespace zuu {
+
+// ============= Specification =============
+
+/**
+ * @brief Parameter CRC reflected (refin = refout = true)
+ * @tparam T uint32_t atau uint64_t (width CRC)
+ * @tparam Poly Polinom dalam bentuk reflected (mis. 0xEDB88320 untuk CRC-32)
+ */
+template <typename T, T Poly, T Init = static_cast<T>(~T{0}), T XorOut = static_cast<T>(~T{0})>
+requires (std::is_same_v<T, uint32_t> || std::is_same_v<T, uint64_t>)
+struct crc_spec {
+    using value_type = T;
+    static constexpr T poly = Poly;
+    static constexpr T init = Init;
+    static constexpr T xor_out = XorOut;
+    static constexpr unsigned width = sizeof(T) * 8;
+};
+
+/** @brief CRC-32 (IEEE 802.3, zlib, PNG) */
+using crc32_spec = crc_spec<uint32_t, 0xEDB88320u>;
+
+/** @brief CRC-32C (Castagnoli; iSCSI, ext4, SSE4.2) */
+using crc32c_spec = crc_spec<uint32_t, 0x82F63B78u>;
+
+/** @brief CRC-64/XZ (ECMA-182 reflected) */
+using crc64_spec = crc_spec<uint64_t, 0xC96C5795D7870F42ull>;
+
+namespace detail::crc {
+
+// ============= GF(2) Arithmetic =============
+
+// Representasi reflected: bit (width - 1 - d) adalah koefisien x^d.
+
+/** @brief a * b mod P */
+template <typename Spec>
+[[nodiscard]] constexpr typename Spec::value_type multmodp(typename Spec::value_type a,
+                                                           typename Spec::value_type b) noexcept {
+    using T = typename Spec::value_type;
+    T p = 0;
+    for (T m = T{1} << (Spec::width - 1); m != 0; m >>= 1) {
+        if (a & m) p ^= b;
+        b = (b & 1) ? static_cast<T>((b >> 1) ^ Spec::poly) : static_cast<T>(b >> 1);
+    }
+    return p;
+}
+
+/** @brief Tabel x^(2^k) mod P, k = 0..71 (cukup untuk panjang bit 64-bit) */
+template <typename Spec>
+[[nodiscard]] constexpr auto make_x2n() noexcept {
+    using T = typename Spec::value_type;
+    std::array<T, 72> t{};
+    t[0] = T{1} << (Spec::width - 2);
+    for (size_t k = 1; k < t.size(); ++k) t[k] = multmodp<Spec>(t[k - 1], t[k - 1]);
+    return t;
+}
+
+template <typename Spec>
+inline constexpr auto x2n = make_x2n<Spec>();
+
+/** @brief x^(n * 2^k) mod P */
+template <typename Spec>
+[[nodiscard]] constexpr typename Spec::value_type xnmodp(uint64_t n, unsigned k = 0) noexcept {
+    using T = typename Spec::value_type;
+    T p = T{1} << (Spec::width - 1);
+    for (; n != 0; n >>= 1, ++k) {
+        if (n & 1) p = multmodp<Spec>(x2n<Spec>[k], p);
+    }
+    return p;
+}
+
+/** @brief Register digeser sejauh n byte nol: r * x^(8n) mod P */
+template <typename Spec>
+[[nodiscard]] constexpr typename Spec::value_type shift(typename Spec::value_type r, uint64_t n) noexcept {
+    return multmodp<Spec>(xnmodp<Spec>(n, 3), r);
+}
+
+// ============= Software (Slicing-by-8) =============
+
+template <typename Spec>
+[[nodiscard]] constexpr auto make_tables() noexcept {
+    using T = typename Spec::value_type;
+    std::array<std::array<T, 256>, 8> t{};
+    for (unsigned i = 0; i < 256; ++i) {
+        T c = static_cast<T>(i);
+        for (int k = 0; k < 8; ++k) c = (c & 1) ? static_cast<T>((c >> 1) ^ Spec::poly) : static_cast<T>(c >> 1);
+        t[0][i] = c;
+    }
+    for (size_t k = 1; k < 8; ++k) {
+        for (unsigned i = 0; i < 256; ++i) t[k][i] = static_cast<T>((t[k - 1][i] >> 8) ^ t[0][t[k - 1][i] & 0xFF]);
+    }
+    return t;
+}
+
+template <typename Spec>
+inline constexpr auto tables = make_tables<Spec>();
+
+/** @brief Update register mentah (sebelum xor_out) */
+template <typename Spec>
+[[nodiscard]] constexpr typename Spec::value_type update_table(typename Spec::value_type r,
+                                                               const uint8_t* p, size_t n) noexcept {
+    using T = typename Spec::value_type;
+    const auto& t = tables<Spec>;
+    for (; n >= 8; n -= 8, p += 8) {
+        uint64_t w = 0;
+        if (std::is_constant_evaluated() || !is_little_endian) {
+            for (size_t i = 0; i < 8; ++i) w |= static_cast<uint64_t>(p[i]) << (i * 8);
+        } else {
+            w = simd::load_u64(p);
+        }
+        w ^= r;
+        r = static_cast<T>(t[7][w & 0xFF] ^ t[6][(w >> 8) & 0xFF] ^ t[5][(w >> 16) & 0xFF] ^
+                           t[4][(w >> 24) & 0xFF] ^ t[3][(w >> 32) & 0xFF] ^ t[2][(w >> 40) & 0xFF] ^
+                           t[1][(w >> 48) & 0xFF] ^ t[0][w >> 56]);
+    }
+    for (; n > 0; --n, ++p) r = static_cast<T>((r >> 8) ^ t[0][(r ^ *p) & 0xFF]);
+    return r;
+}
+
+using crc32_fn = uint32_t (*)(uint32_t, const uint8_t*, size_t) noexcept;
+using crc64_fn = uint64_t (*)(uint64_t, const uint8_t*, size_t) noexcept;
+
+template <typename Spec>
+using update_fn = std::conditional_t<std::is_same_v<typename Spec::value_type, uint32_t>, crc32_fn, crc64_fn>;
+
+template <typename Spec>
+typename Spec::value_type update_table_rt(typename Spec::value_type r, const uint8_t* p, size_t n) noexcept {
+    return update_table<Spec>(r, p, n);
+}
+
+// ============= SSE4.2 CRC32C =============
+
+/** @brief Tabel geser register sejauh Block byte nol (4 lookup per geser) */
+template <size_t Block>
+struct zeros_table {
+    std::array<std::array<uint32_t, 256>, 4> t{};
+
+    constexpr zeros_table() noexcept {
+        const uint32_t xn = xnmodp<crc32c_spec>(Block, 3);
+        for (unsigned k = 0; k < 4; ++k) {
+            for (uint32_t b = 0; b < 256; ++b) t[k][b] = multmodp<crc32c_spec>(xn, b << (8 * k));
+        }
+    }
+
+    [[nodiscard]] constexpr uint32_t operator()(uint32_t r) const noexcept {
+        return t[0][r & 0xFF] ^ t[1][(r >> 8) & 0xFF] ^ t[2][(r >> 16) & 0xFF] ^ t[3][r >> 24];
+    }
+};
+
+/** @brief Panjang aliran interleave (byte); buffer < 3 * short_block tidak di-interleave */
+inline constexpr size_t long_block = 8192;
+inline constexpr size_t short_block = 256;
+
+inline constexpr zeros_table<long_block> long_zeros{};
+inline constexpr zeros_table<short_block> short_zeros{};
+
+#if defined(ZUU_SIMD_X86) && defined(__x86_64__)
+
+/**
+ * @brief Tiga aliran crc32 independen di atas [p, p + 3*Block), digabung
+ *        dengan geser register (crc linear terhadap data)
+ */
+template <size_t Block>
+ZUU_TARGET("sse4.2")
+uint64_t crc32c_sse42_3way(uint64_t c0, const uint8_t*& p, size_t& n, const zeros_table<Block>& z) noexcept {
+    while (n >= 3 * Block) {
+        uint64_t c1 = 0, c2 = 0;
+        for (size_t i = 0; i < Block; i += 8) {
+            c0 = _mm_crc32_u64(c0, simd::load_u64(p + i));
+            c1 = _mm_crc32_u64(c1, simd::load_u64(p + Block + i));
+            c2 = _mm_crc32_u64(c2, simd::load_u64(p + 2 * Block + i));
+        }
+        c0 = z(static_cast<uint32_t>(c0)) ^ c1;
+        c0 = z(static_cast<uint32_t>(c0)) ^ c2;
+        p += 3 * Block;
+        n -= 3 * Block;
+    }
+    return c0;
+}
+
+ZUU_TARGET("sse4.2")
+inline uint32_t crc32c_sse42(uint32_t r, const uint8_t* p, size_t n) noexcept {
+    uint64_t c = r;
+    c = crc32c_sse42_3way(c, p, n, long_zeros);
+    c = crc32c_sse42_3way(c, p, n, short_zeros);
+    for (; n >= 8; n -= 8, p += 8) c = _mm_crc32_u64(c, simd::load_u64(p));
+    uint32_t c32 = static_cast<uint32_t>(c);
+    for (; n > 0; --n, ++p) c32 = _mm_crc32_u8(c32, *p);
+    return c32;
+}
+
+// ============= PCLMULQDQ Folding =============
+
+// Blok 128-bit reflected: bit i = koefisien x^(127 - i). Folding sejauh D
+// bit: qword rendah (x^127..x^64) dikali x^(D+63) dan qword tinggi dikali
+// x^(D-1); -1 mengkompensasi clmul reflected yang hasilnya bergeser 1 bit.
+
+/** @brief x^d mod P sebagai operand clmul 64-bit reflected */
+template <typename Spec>
+[[nodiscard]] constexpr uint64_t clmul_constant(uint64_t d) noexcept {
+    return static_cast<uint64_t>(xnmodp<Spec>(d)) << (64 - Spec::width);
+}
+
+template <typename Spec, uint64_t D>
+inline constexpr uint64_t fold_hi = clmul_constant<Spec>(D + 63);
+
+template <typename Spec, uint64_t D>
+inline constexpr uint64_t fold_lo = clmul_constant<Spec>(D - 1);
+
+ZUU_TARGET("sse2")
+inline __m128i load128(const uint8_t* p) noexcept {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+}
+
+ZUU_TARGET("pclmul,sse2")
+inline __m128i fold(__m128i acc, __m128i k, __m128i next) noexcept {
+    const __m128i lo = _mm_clmulepi64_si128(acc, k, 0x00);
+    const __m128i hi = _mm_clmulepi64_si128(acc, k, 0x11);
+    return _mm_xor_si128(_mm_xor_si128(lo, hi), next);
+}
+
+template <typename Spec>
+ZUU_TARGET("pclmul,sse2")
+typename Spec::value_type update_clmul(typename Spec::value_type r, const uint8_t* p, size_t n) noexcept {
+    if (n < 64) return update_table<Spec>(r, p, n);
+
+    const __m128i k512 = _mm_set_epi64x(static_cast<long long>(fold_lo<Spec, 512>),
+                                        static_cast<long long>(fold_hi<Spec, 512>));
+    const __m128i k128 = _mm_set_epi64x(static_cast<long long>(fold_lo<Spec, 128>),
+                                        static_cast<long long>(fold_hi<Spec, 128>));
+    // crc(r, D) == crc(0, D ^ r): register masuk ke byte pertama blok
+    __m128i x0 = _mm_xor_si128(load128(p), _mm_cvtsi64_si128(static_cast<long long>(r)));
+    __m128i x1 = load128(p + 16), x2 = load128(p + 32), x3 = load128(p + 48);
+    p += 64;
+    n -= 64;
+
+    for (; n >= 64; n -= 64, p += 64) {
+        x0 = fold(x0, k512, load128(p));
+        x1 = fold(x1, k512, load128(p + 16));
+        x2 = fold(x2, k512, load128(p + 32));
+        x3 = fold(x3, k512, load128(p + 48));
+    }
+
+    x1 = fold(x0, k128, x1);
+    x2 = fold(x1, k128, x2);
+    __m128i acc = fold(x2, k128, x3);
+    for (; n >= 16; n -= 16, p += 16) acc = fold(acc, k128, load128(p));
+
+    // acc kongruen dengan prefix yang sudah diproses: reduksi akhir via tabel
+    alignas(16) uint8_t rest[16];
+    _mm_store_si128(reinterpret_cast<__m128i*>(rest), acc);
+    return update_table<Spec>(update_table<Spec>(0, rest, 16), p, n);
+}
+
+#endif
+
+template <typename Spec>
+[[nodiscard]] inline update_fn<Spec> select() noexcept {
+#if defined(ZUU_SIMD_X86) && defined(__x86_64__)
+    const auto& f = simd::cpu();
+    if constexpr (std::is_same_v<Spec, crc32c_spec>) {
+        if (f.sse42) return &crc32c_sse42;
+    }
+    if (f.pclmul && is_little_endian) return &update_clmul<Spec>;
+#endif
+    return &update_table_rt<Spec>;
+}
+
+template <typename Spec>
+[[nodiscard]] inline typename Spec::value_type update_dispatch(typename Spec::value_type r,
+                                                               const uint8_t* p, size_t n) noexcept {
+    static const update_fn<Spec> fn = select<Spec>();
+    return fn(r, p, n);
+}
+
+/** @brief Update register mentah dengan kernel terbaik (tabel saat constant evaluation) */
+template <typename Spec>
+[[nodiscard]] constexpr typename Spec::value_type update(typename Spec::value_type r,
+                                                         const uint8_t* p, size_t n) noexcept {
+    if (std::is_constant_evaluated()) return update_table<Spec>(r, p, n);
+    return update_dispatch<Spec>(r, p, n);
+}
+
+} // namespace detail::crc
+
+// ============= Incremental =============
+
+/**
+ * @brief CRC incremental
+ * @tparam Spec crc_spec (mis. crc32c_spec)
+ *
+ * @example
+ * ```cpp
+ * crc_engine<crc64_spec> e;
+ * e.update(header).update(payload);
+ * uint64_t v = e.value();
+ * ```
+ */
+template <typename Spec>
+class crc_engine {
+public:
+    using value_type = typename Spec::value_type;
+
+private:
+    value_type reg_ = Spec::init;
+
+public:
+    constexpr crc_engine() noexcept = default;
+
+    constexpr crc_engine& update(const uint8_t* data, size_t len) noexcept {
+        reg_ = detail::crc::update<Spec>(reg_, data, len);
+        return *this;
+    }
+
+    constexpr crc_engine& update(std::span<const uint8_t> data) noexcept {
+        return update(data.data(), data.size());
+    }
+
+    template <size_t N>
+    constexpr crc_engine& update(const bytes<N>& b) noexcept { return update(b.data(), N); }
+
+    template <typename T>
+    crc_engine& update(const composer<T>& c) noexcept { return update(c.data(), c.size()); }
+
+    /** @brief CRC final (xor_out diterapkan); engine tetap dapat di-update */
+    [[nodiscard]] constexpr value_type value() const noexcept {
+        return static_cast<value_type>(reg_ ^ Spec::xor_out);
+    }
+
+    constexpr void reset() noexcept { reg_ = Spec::init; }
+};
+
+// ============= One-shot =============
+
+/** @brief CRC final dari satu buffer */
+template <typename Spec>
+[[nodiscard]] constexpr typename Spec::value_type crc(std::span<const uint8_t> data) noexcept {
+    return crc_engine<Spec>().update(data).value();
+}
+
+/**
+ * @brief CRC dari a || b diberikan crc(a), crc(b) dan panjang b
+ * @note O(log len_b), tanpa membaca data
+ */
+template <typename Spec>
+[[nodiscard]] constexpr typename Spec::value_type crc_combine(typename Spec::value_type crc_a,
+                                                              typename Spec::value_type crc_b,
+                                                              uint64_t len_b) noexcept {
+    // reg(a||b) = shift(reg_a) ^ reg_b ^ shift(init); xor_out diterapkan pada ketiganya
+    using T = typename Spec::value_type;
+    const T shifted = static_cast<T>(crc_a ^ Spec::xor_out ^ Spec::init);
+    return static_cast<T>(detail::crc::shift<Spec>(shifted, len_b) ^ crc_b);
+}
+
+/** @brief CRC-32C; prev = hasil sebelumnya untuk melanjutkan (0 untuk awal) */
+[[nodiscard]] constexpr uint32_t crc32c(std::span<const uint8_t> data, uint32_t prev = 0) noexcept {
+    return ~detail::crc::update<crc32c_spec>(~prev, data.data(), data.size());
+}
+
+/** @brief CRC-32 (IEEE); prev = hasil sebelumnya untuk melanjutkan */
+[[nodiscard]] constexpr uint32_t crc32(std::span<const uint8_t> data, uint32_t prev = 0) noexcept {
+    return ~detail::crc::update<crc32_spec>(~prev, data.data(), data.size());
+}
+
+/** @brief CRC-64/XZ; prev = hasil sebelumnya untuk melanjutkan */
+[[nodiscard]] constexpr uint64_t crc64(std::span<const uint8_t> data, uint64_t prev = 0) noexcept {
+    return ~detail::crc::update<crc64_spec>(~prev, data.data(), data.size());
+}
+
+template <size_t N>
+[[nodiscard]] constexpr uint32_t crc32c(const bytes<N>& b, uint32_t prev = 0) noexcept {
+    return crc32c(std::span<const uint8_t>(b.data(), N), prev);
+}
+
+template <size_t N>
+[[nodiscard]] constexpr uint32_t crc32(const bytes<N>& b, uint32_t prev = 0) noexcept {
+    return crc32(std::span<const uint8_t>(b.data(), N), prev);
+}
+
+template <size_t N>
+[[nodiscard]] constexpr uint64_t crc64(const bytes<N>& b, uint64_t prev = 0) noexcept {
+    return crc64(std::span<const uint8_t>(b.data(), N), prev);
+}
+
+/** @brief CRC atas representasi byte value (composer::as_bytes) */
+template <typename T>
+[[nodiscard]] uint32_t crc32c(const composer<T>& c, uint32_t prev = 0) noexcept {
+    return crc32c(std::span<const uint8_t>(c.as_bytes()), prev);
+}
+
+template <typename T>
+[[nodiscard]] uint32_t crc32(const composer<T>& c, uint32_t prev = 0) noexcept {
+    return crc32(std::span<const uint8_t>(c.as_bytes()), prev);
+}
+
+template <typename T>
+[[nodiscard]] uint64_t crc64(const composer<T>& c, uint64_t prev = 0) noexcept {
+    return crc64(std::span<const uint8_t>(c.as_bytes()), prev);
+}
+
+} // namespace zuu
@@ -0,0 +1,624 @@
+#pragma once
+
+/**
+ * @file encoding.hpp
+ * @brief Encode/decode hex dan base64 untuk bytes<N> dan buffer
+ * @version 1.0.0
+ *
+ * Menyediakan:
+ * - to_hex / from_hex, to_base64 / from_base64 untuk bytes<N> (constexpr,
+ *   hasil berukuran tetap tanpa alokasi)
+ * - Versi span/pointer (hex_encode, hex_decode, base64_encode, base64_decode)
+ *   dan versi std::string / byte_buffer
+ * - Kernel lookup-table SSSE3 dan AVX2 (pshufb) dengan runtime dispatch,
+ *   fallback scalar berbasis tabel untuk platform lain
+ *
+ * Decoder strict: hex menerima huruf besar/kecil tetapi panjang harus genap;
+ * base64 memakai alfabet standar (RFC 4648) dengan padding wajib dan bit sisa
+ * pada simbol terakhir harus nol (hanya bentuk kanonik yang diterima).
+ *
+ * @note Error dilaporkan seperti std::from_chars: errc::invalid_argument
+ *       dengan ptr menunjuk karakter invalid pertama, atau first jika
+ *       panjang input salah
+ *
+ * @example
+ * ```cpp
+ * bytes<16> id = ...;
+ * auto hex = to_hex(id);                  // encoded_chars<32>, constexpr
+ * log(hex.view());
+ * bytes<16> back;
+ * if (from_hex(hex.view(), back).ec != std::errc{}) { ... }
+ * std::string b64 = to_base64(bytes_view(payload, len));
+ * ```
+ */
+
+#include "byte_buffer.hpp"
+#include "bytes.hpp"
+#include "simd.hpp"
+#include <array>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace zuu {
+
+/** @brief Huruf untuk digit hex a..f */
+enum class hex_case : uint8_t { lower, upper };
+
+// ============= Sizes =============
+
+/** @brief Jumlah karakter hex untuk n byte */
+[[nodiscard]] constexpr size_t hex_encoded_size(size_t n) noexcept { return n * 2; }
+
+/** @brief Jumlah karakter base64 (dengan padding) untuk n byte */
+[[nodiscard]] constexpr size_t base64_encoded_size(size_t n) noexcept { return (n + 2) / 3 * 4; }
+
+/** @brief Jumlah byte hasil decode hex (input harus berpanjang genap) */
+[[nodiscard]] constexpr size_t hex_decoded_size(size_t chars) noexcept { return chars / 2; }
+
+/** @brief Jumlah byte hasil decode base64, memperhitungkan padding */
+[[nodiscard]] constexpr size_t base64_decoded_size(std::string_view s) noexcept {
+    if (s.size() < 4 || s.size() % 4 != 0) return 0;
+    const size_t pad = s[s.size() - 1] != '=' ? 0 : (s[s.size() - 2] == '=' ? 2 : 1);
+    return s.size() / 4 * 3 - pad;
+}
+
+// ============= Fixed-size Result =============
+
+/**
+ * @brief Karakter hasil encode berukuran compile-time (tanpa alokasi)
+ * @tparam M Jumlah karakter
+ */
+template <size_t M>
+struct encoded_chars {
+    char chars[M > 0 ? M : 1]{};
+
+    [[nodiscard]] static constexpr size_t size() noexcept { return M; }
+    [[nodiscard]] constexpr const char* data() const noexcept { return chars; }
+    [[nodiscard]] constexpr const char* begin() const noexcept { return chars; }
+    [[nodiscard]] constexpr const char* end() const noexcept { return chars + M; }
+    [[nodiscard]] constexpr std::string_view view() const noexcept { return {chars, M}; }
+    [[nodiscard]] constexpr operator std::string_view() const noexcept { return view(); }
+    [[nodiscard]] std::string str() const { return std::string(chars, M); }
+
+    [[nodiscard]] constexpr bool operator==(const encoded_chars&) const noexcept = default;
+};
+
+namespace detail::encoding {
+
+// ============= Tables =============
+
+inline constexpr char hex_lower[] = "0123456789abcdef";
+inline constexpr char hex_upper[] = "0123456789ABCDEF";
+inline constexpr char base64_chars[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+/** @brief Nilai tabel decode untuk karakter di luar alfabet */
+inline constexpr uint8_t bad = 0xFF;
+
+[[nodiscard]] constexpr std::array<uint8_t, 256> make_hex_values() noexcept {
+    std::array<uint8_t, 256> t{};
+    for (auto& v : t) v = bad;
+    for (uint8_t i = 0; i < 16; ++i) {
+        t[static_cast<uint8_t>(hex_lower[i])] = i;
+        t[static_cast<uint8_t>(hex_upper[i])] = i;
+    }
+    return t;
+}
+
+[[nodiscard]] constexpr std::array<uint8_t, 256> make_base64_values() noexcept {
+    std::array<uint8_t, 256> t{};
+    for (auto& v : t) v = bad;
+    for (uint8_t i = 0; i < 64; ++i) t[static_cast<uint8_t>(base64_chars[i])] = i;
+    return t;
+}
+
+inline constexpr auto hex_values = make_hex_values();
+inline constexpr auto base64_values = make_base64_values();
+
+[[nodiscard]] constexpr const char* hex_digits(hex_case c) noexcept {
+    return c == hex_case::upper ? hex_upper : hex_lower;
+}
+
+// ============= Scalar Kernels =============
+
+constexpr void hex_encode_scalar(const uint8_t* in, size_t n, char* out, const char* digits) noexcept {
+    for (size_t i = 0; i < n; ++i) {
+        out[2 * i] = digits[in[i] >> 4];
+        out[2 * i + 1] = digits[in[i] & 0x0F];
+    }
+}
+
+/** @brief Decode n pasangan; nullptr jika sukses, atau karakter invalid pertama */
+constexpr const char* hex_decode_scalar(const char* in, size_t n, uint8_t* out) noexcept {
+    for (size_t i = 0; i < n; ++i) {
+        const uint8_t hi = hex_values[static_cast<uint8_t>(in[2 * i])];
+        const uint8_t lo = hex_values[static_cast<uint8_t>(in[2 * i + 1])];
+        if (hi == bad) return in + 2 * i;
+        if (lo == bad) return in + 2 * i + 1;
+        out[i] = static_cast<uint8_t>((hi << 4) | lo);
+    }
+    return nullptr;
+}
+
+/** @brief Encode n byte (termasuk padding untuk sisa 1-2 byte) */
+constexpr void base64_encode_scalar(const uint8_t* in, size_t n, char* out) noexcept {
+    size_t i = 0;
+    for (; i + 3 <= n; i += 3, out += 4) {
+        const uint32_t v = (uint32_t{in[i]} << 16) | (uint32_t{in[i + 1]} << 8) | in[i + 2];
+        out[0] = base64_chars[v >> 18];
+        out[1] = base64_chars[(v >> 12) & 0x3F];
+        out[2] = base64_chars[(v >> 6) & 0x3F];
+        out[3] = base64_chars[v & 0x3F];
+    }
+    if (n - i == 1) {
+        out[0] = base64_chars[in[i] >> 2];
+        out[1] = base64_chars[(in[i] & 0x03) << 4];
+        out[2] = out[3] = '=';
+    } else if (n - i == 2) {
+        out[0] = base64_chars[in[i] >> 2];
+        out[1] = base64_chars[((in[i] & 0x03) << 4) | (in[i + 1] >> 4)];
+        out[2] = base64_chars[(in[i + 1] & 0x0F) << 2];
+        out[3] = '=';
+    }
+}
+
+/** @brief Decode quads lengkap tanpa padding; nullptr jika sukses */
+constexpr const char* base64_decode_scalar(const char* in, size_t quads, uint8_t* out) noexcept {
+    for (size_t q = 0; q < quads; ++q, in += 4, out += 3) {
+        uint32_t v = 0;
+        for (size_t k = 0; k < 4; ++k) {
+            const uint8_t d = base64_values[static_cast<uint8_t>(in[k])];
+            if (d == bad) return in + k;
+            v = (v << 6) | d;
+        }
+        out[0] = static_cast<uint8_t>(v >> 16);
+        out[1] = static_cast<uint8_t>(v >> 8);
+        out[2] = static_cast<uint8_t>(v);
+    }
+    return nullptr;
+}
+
+// ============= SIMD Kernels =============
+
+// Setiap kernel memproses blok penuh dan mengembalikan jumlah unit yang
+// sudah diproses; sisanya (dan blok yang mengandung karakter invalid)
+// diteruskan ke jalur scalar, yang juga menentukan posisi error.
+
+/** @brief Byte input terproses; digits = 16 karakter hex */
+using hex_encode_fn = size_t (*)(const uint8_t*, size_t, char*, const char*) noexcept;
+/** @brief Pasangan karakter (= byte output) terproses */
+using hex_decode_fn = size_t (*)(const char*, size_t, uint8_t*) noexcept;
+/** @brief Byte input terproses (kelipatan 3) */
+using base64_encode_fn = size_t (*)(const uint8_t*, size_t, char*) noexcept;
+/** @brief Karakter input terproses (kelipatan 4), tanpa quad terakhir */
+using base64_decode_fn = size_t (*)(const char*, size_t, uint8_t*) noexcept;
+
+#ifdef ZUU_SIMD_X86
+
+ZUU_TARGET("ssse3")
+inline size_t hex_encode_ssse3(const uint8_t* in, size_t n, char* out, const char* digits) noexcept {
+    const __m128i lut = _mm_loadu_si128(reinterpret_cast<const __m128i*>(digits));
+    const __m128i nib = _mm_set1_epi8(0x0F);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        const __m128i hi = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(x, 4), nib));
+        const __m128i lo = _mm_shuffle_epi8(lut, _mm_and_si128(x, nib));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2 * i + 16), _mm_unpackhi_epi8(hi, lo));
+    }
+    return i;
+}
+
+ZUU_TARGET("avx2")
+inline size_t hex_encode_avx2(const uint8_t* in, size_t n, char* out, const char* digits) noexcept {
+    const __m256i lut = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(digits)));
+    const __m256i nib = _mm256_set1_epi8(0x0F);
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        const __m256i hi = _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(x, 4), nib));
+        const __m256i lo = _mm256_shuffle_epi8(lut, _mm256_and_si256(x, nib));
+        // unpack bekerja per lane 128-bit: susun ulang lane agar urut
+        const __m256i a = _mm256_unpacklo_epi8(hi, lo);
+        const __m256i b = _mm256_unpackhi_epi8(hi, lo);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 2 * i), _mm256_permute2x128_si256(a, b, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + 2 * i + 32), _mm256_permute2x128_si256(a, b, 0x31));
+    }
+    return i + hex_encode_ssse3(in + i, n - i, out + 2 * i, digits);
+}
+
+/** @brief Nilai nibble per karakter; valid = 0xFF jika semua karakter hex */
+ZUU_TARGET("ssse3")
+inline __m128i hex_nibbles_ssse3(__m128i c, int& valid) noexcept {
+    const __m128i d = _mm_sub_epi8(c, _mm_set1_epi8('0'));
+    const __m128i is_digit = _mm_cmpeq_epi8(_mm_min_epu8(d, _mm_set1_epi8(9)), d);
+    const __m128i l = _mm_sub_epi8(_mm_or_si128(c, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+    const __m128i is_alpha = _mm_cmpeq_epi8(_mm_min_epu8(l, _mm_set1_epi8(5)), l);
+    valid = _mm_movemask_epi8(_mm_or_si128(is_digit, is_alpha));
+    return _mm_or_si128(_mm_and_si128(is_digit, d),
+                        _mm_and_si128(is_alpha, _mm_add_epi8(l, _mm_set1_epi8(10))));
+}
+
+ZUU_TARGET("ssse3")
+inline size_t hex_decode_ssse3(const char* in, size_t n, uint8_t* out) noexcept {
+    // maddubs: hi * 16 + lo untuk setiap pasangan byte
+    const __m128i weights = _mm_set1_epi16(0x0110);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        int v0, v1;
+        const __m128i a = hex_nibbles_ssse3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 2 * i)), v0);
+        const __m128i b = hex_nibbles_ssse3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + 2 * i + 16)), v1);
+        if ((v0 & v1) != 0xFFFF) break;
+        const __m128i r = _mm_packus_epi16(_mm_maddubs_epi16(a, weights), _mm_maddubs_epi16(b, weights));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), r);
+    }
+    return i;
+}
+
+ZUU_TARGET("avx2")
+inline __m256i hex_nibbles_avx2(__m256i c, uint32_t& valid) noexcept {
+    const __m256i d = _mm256_sub_epi8(c, _mm256_set1_epi8('0'));
+    const __m256i is_digit = _mm256_cmpeq_epi8(_mm256_min_epu8(d, _mm256_set1_epi8(9)), d);
+    const __m256i l = _mm256_sub_epi8(_mm256_or_si256(c, _mm256_set1_epi8(0x20)), _mm256_set1_epi8('a'));
+    const __m256i is_alpha = _mm256_cmpeq_epi8(_mm256_min_epu8(l, _mm256_set1_epi8(5)), l);
+    valid = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(is_digit, is_alpha)));
+    return _mm256_or_si256(_mm256_and_si256(is_digit, d),
+                           _mm256_and_si256(is_alpha, _mm256_add_epi8(l, _mm256_set1_epi8(10))));
+}
+
+ZUU_TARGET("avx2")
+inline size_t hex_decode_avx2(const char* in, size_t n, uint8_t* out) noexcept {
+    const __m256i weights = _mm256_set1_epi16(0x0110);
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        uint32_t v0, v1;
+        const __m256i a = hex_nibbles_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + 2 * i)), v0);
+        const __m256i b = hex_nibbles_avx2(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + 2 * i + 32)), v1);
+        if ((v0 & v1) != 0xFFFFFFFFu) break;
+        // packus per lane menghasilkan [a0 b0 a1 b1]: kembalikan ke [a0 a1 b0 b1]
+        const __m256i r = _mm256_packus_epi16(_mm256_maddubs_epi16(a, weights), _mm256_maddubs_epi16(b, weights));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), _mm256_permute4x64_epi64(r, 0xD8));
+    }
+    return i + hex_decode_ssse3(in + 2 * i, n - i, out + i);
+}
+
+// Base64 mengikuti skema Muła/Lemire: 3 byte -> 4 index 6-bit via
+// pshufb + mulhi/mullo, lalu index -> ASCII via tabel offset 16 entri.
+
+/** @brief 12 byte (di lane) -> 16 index 6-bit, satu per byte */
+ZUU_TARGET("ssse3")
+inline __m128i base64_split_ssse3(__m128i in) noexcept {
+    in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    const __m128i t0 = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0FC0FC00)), _mm_set1_epi32(0x04000040));
+    const __m128i t1 = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003F03F0)), _mm_set1_epi32(0x01000010));
+    return _mm_or_si128(t0, t1);
+}
+
+ZUU_TARGET("ssse3")
+inline __m128i base64_ascii_ssse3(__m128i idx) noexcept {
+    // 0..25 -> 13, 26..51 -> 0, 52..61 -> 1..10, 62 -> 11, 63 -> 12
+    __m128i r = _mm_subs_epu8(idx, _mm_set1_epi8(51));
+    r = _mm_or_si128(r, _mm_and_si128(_mm_cmpgt_epi8(_mm_set1_epi8(26), idx), _mm_set1_epi8(13)));
+    const __m128i shift = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                                        '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                                        '/' - 63, 'A', 0, 0);
+    return _mm_add_epi8(_mm_shuffle_epi8(shift, r), idx);
+}
+
+ZUU_TARGET("ssse3")
+inline size_t base64_encode_ssse3(const uint8_t* in, size_t n, char* out) noexcept {
+    size_t i = 0, o = 0;
+    // Load 16 byte untuk memakai 12: sisakan 4 byte agar tidak overread
+    for (; i + 16 <= n; i += 12, o += 16) {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + o), base64_ascii_ssse3(base64_split_ssse3(x)));
+    }
+    return i;
+}
+
+ZUU_TARGET("avx2")
+inline size_t base64_encode_avx2(const uint8_t* in, size_t n, char* out) noexcept {
+    const __m256i shuf = _mm256_broadcastsi128_si256(
+        _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    const __m256i shift = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+                      '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62,
+                      '/' - 63, 'A', 0, 0));
+    size_t i = 0, o = 0;
+    for (; i + 28 <= n; i += 24, o += 32) {
+        // lane 0 = byte [0, 12), lane 1 = byte [12, 24)
+        __m256i x = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i))),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i + 12)), 1);
+        x = _mm256_shuffle_epi8(x, shuf);
+        const __m256i t0 = _mm256_mulhi_epu16(_mm256_and_si256(x, _mm256_set1_epi32(0x0FC0FC00)),
+                                              _mm256_set1_epi32(0x04000040));
+        const __m256i t1 = _mm256_mullo_epi16(_mm256_and_si256(x, _mm256_set1_epi32(0x003F03F0)),
+                                              _mm256_set1_epi32(0x01000010));
+        const __m256i idx = _mm256_or_si256(t0, t1);
+        __m256i r = _mm256_subs_epu8(idx, _mm256_set1_epi8(51));
+        r = _mm256_or_si256(r, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), idx),
+                                                _mm256_set1_epi8(13)));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + o),
+                            _mm256_add_epi8(_mm256_shuffle_epi8(shift, r), idx));
+    }
+    return i + base64_encode_ssse3(in + i, n - i, out + o);
+}
+
+/**
+ * @brief 16 karakter -> 16 nilai 6-bit; invalid != 0 jika ada karakter
+ *        di luar alfabet (rentang dipilih per nibble atas)
+ */
+ZUU_TARGET("ssse3")
+inline __m128i base64_values_ssse3(__m128i c, int& invalid) noexcept {
+    const __m128i hi = _mm_and_si128(_mm_srli_epi32(c, 4), _mm_set1_epi8(0x0F));
+    const __m128i lower = _mm_setr_epi8(1, 1, 0x2B, 0x30, 0x41, 0x50, 0x61, 0x70, 1, 1, 1, 1, 1, 1, 1, 1);
+    const __m128i upper = _mm_setr_epi8(0, 0, 0x2B, 0x39, 0x4F, 0x5A, 0x6F, 0x7A, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i shift = _mm_setr_epi8(0, 0, 0x3E - 0x2B, 0x34 - 0x30, 0x00 - 0x41, 0x0F - 0x50,
+                                        0x1A - 0x61, 0x29 - 0x70, 0, 0, 0, 0, 0, 0, 0, 0);
+    const __m128i below = _mm_cmplt_epi8(c, _mm_shuffle_epi8(lower, hi));
+    const __m128i above = _mm_cmpgt_epi8(c, _mm_shuffle_epi8(upper, hi));
+    const __m128i slash = _mm_cmpeq_epi8(c, _mm_set1_epi8('/'));
+    invalid = _mm_movemask_epi8(_mm_andnot_si128(slash, _mm_or_si128(below, above)));
+    const __m128i v = _mm_add_epi8(c, _mm_shuffle_epi8(shift, hi));
+    return _mm_add_epi8(v, _mm_and_si128(slash, _mm_set1_epi8(-3)));
+}
+
+/** @brief 16 nilai 6-bit -> 12 byte di awal register */
+ZUU_TARGET("ssse3")
+inline __m128i base64_pack_ssse3(__m128i v) noexcept {
+    const __m128i ab_bc = _mm_maddubs_epi16(v, _mm_set1_epi32(0x01400140));
+    const __m128i abcd = _mm_madd_epi16(ab_bc, _mm_set1_epi32(0x00011000));
+    return _mm_shuffle_epi8(abcd, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
+
+ZUU_TARGET("ssse3")
+inline size_t base64_decode_ssse3(const char* in, size_t n, uint8_t* out) noexcept {
+    size_t i = 0, o = 0;
+    // Store 16 byte untuk 12 valid: sisakan >= 8 karakter agar output cukup
+    for (; i + 24 <= n; i += 16, o += 12) {
+        int invalid;
+        const __m128i v = base64_values_ssse3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i)), invalid);
+        if (invalid) break;
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + o), base64_pack_ssse3(v));
+    }
+    return i;
+}
+
+ZUU_TARGET("avx2")
+inline size_t base64_decode_avx2(const char* in, size_t n, uint8_t* out) noexcept {
+    const __m256i lower = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(1, 1, 0x2B, 0x30, 0x41, 0x50, 0x61, 0x70, 1, 1, 1, 1, 1, 1, 1, 1));
+    const __m256i upper = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(0, 0, 0x2B, 0x39, 0x4F, 0x5A, 0x6F, 0x7A, 0, 0, 0, 0, 0, 0, 0, 0));
+    const __m256i shift = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(0, 0, 0x3E - 0x2B, 0x34 - 0x30, 0x00 - 0x41, 0x0F - 0x50,
+                      0x1A - 0x61, 0x29 - 0x70, 0, 0, 0, 0, 0, 0, 0, 0));
+    const __m256i pack = _mm256_broadcastsi128_si256(
+        _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+    size_t i = 0, o = 0;
+    // Store 32 byte untuk 24 valid: sisakan >= 16 karakter
+    for (; i + 48 <= n; i += 32, o += 24) {
+        const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + i));
+        const __m256i hi = _mm256_and_si256(_mm256_srli_epi32(c, 4), _mm256_set1_epi8(0x0F));
+        const __m256i below = _mm256_cmpgt_epi8(_mm256_shuffle_epi8(lower, hi), c);
+        const __m256i above = _mm256_cmpgt_epi8(c, _mm256_shuffle_epi8(upper, hi));
+        const __m256i slash = _mm256_cmpeq_epi8(c, _mm256_set1_epi8('/'));
+        if (_mm256_movemask_epi8(_mm256_andnot_si256(slash, _mm256_or_si256(below, above)))) break;
+        __m256i v = _mm256_add_epi8(c, _mm256_shuffle_epi8(shift, hi));
+        v = _mm256_add_epi8(v, _mm256_and_si256(slash, _mm256_set1_epi8(-3)));
+        const __m256i ab_bc = _mm256_maddubs_epi16(v, _mm256_set1_epi32(0x01400140));
+        const __m256i abcd = _mm256_madd_epi16(ab_bc, _mm256_set1_epi32(0x00011000));
+        // 12 byte per lane -> 24 byte berurutan
+        const __m256i r = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(abcd, pack),
+                                                      _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + o), r);
+    }
+    return i + base64_decode_ssse3(in + i, n - i, out + o);
+}
+
+#endif // ZUU_SIMD_X86
+
+/** @brief Kernel terpilih (nullptr = hanya scalar) */
+struct kernels {
+    hex_encode_fn hex_encode = nullptr;
+    hex_decode_fn hex_decode = nullptr;
+    base64_encode_fn base64_encode = nullptr;
+    base64_decode_fn base64_decode = nullptr;
+};
+
+[[nodiscard]] inline const kernels& select() noexcept {
+    static const kernels k = [] {
+        kernels r;
+#ifdef ZUU_SIMD_X86
+        const auto& f = simd::cpu();
+        if (f.avx2) {
+            r = {&hex_encode_avx2, &hex_decode_avx2, &base64_encode_avx2, &base64_decode_avx2};
+        } else if (f.ssse3) {
+            r = {&hex_encode_ssse3, &hex_decode_ssse3, &base64_encode_ssse3, &base64_decode_ssse3};
+        }
+#endif
+        return r;
+    }();
+    return k;
+}
+
+/** @brief Input minimum (byte) dimana dispatch ke kernel vektor menguntungkan */
+inline constexpr size_t dispatch_threshold = 16;
+
+} // namespace detail::encoding
+
+// ============= Span API =============
+
+/**
+ * @brief Tulis 2n karakter hex ke out (tanpa terminator)
+ * @return Pointer setelah karakter terakhir
+ */
+constexpr char* hex_encode(const uint8_t* in, size_t n, char* out, hex_case c = hex_case::lower) noexcept {
+    using namespace detail::encoding;
+    size_t done = 0;
+    if (!std::is_constant_evaluated() && n >= dispatch_threshold) {
+        if (const auto fn = select().hex_encode) done = fn(in, n, out, hex_digits(c));
+    }
+    hex_encode_scalar(in + done, n - done, out + 2 * done, hex_digits(c));
+    return out + 2 * n;
+}
+
+/**
+ * @brief Decode hex [first, last) ke out (hex_decoded_size byte)
+ * @return Seperti std::from_chars; invalid_argument jika panjang ganjil
+ *         (ptr = first) atau ada karakter non-hex (ptr = karakter tersebut)
+ */
+constexpr std::from_chars_result hex_decode(const char* first, const char* last, uint8_t* out) noexcept {
+    using namespace detail::encoding;
+    const size_t len = static_cast<size_t>(last - first);
+    if (len % 2 != 0) return {first, std::errc::invalid_argument};
+    const size_t n = len / 2;
+    size_t done = 0;
+    if (!std::is_constant_evaluated() && n >= dispatch_threshold) {
+        if (const auto fn = select().hex_decode) done = fn(first, n, out);
+    }
+    if (const char* bad_char = hex_decode_scalar(first + 2 * done, n - done, out + done))
+        return {bad_char, std::errc::invalid_argument};
+    return {last, std::errc{}};
+}
+
+/**
+ * @brief Tulis base64_encoded_size(n) karakter base64 (dengan padding)
+ * @return Pointer setelah karakter terakhir
+ */
+constexpr char* base64_encode(const uint8_t* in, size_t n, char* out) noexcept {
+    using namespace detail::encoding;
+    size_t done = 0;
+    if (!std::is_constant_evaluated() && n >= dispatch_threshold) {
+        if (const auto fn = select().base64_encode) done = fn(in, n, out);
+    }
+    base64_encode_scalar(in + done, n - done, out + done / 3 * 4);
+    return out + base64_encoded_size(n);
+}
+
+/**
+ * @brief Decode base64 [first, last) ke out (base64_decoded_size byte)
+ * @return Seperti std::from_chars; invalid_argument jika panjang bukan
+ *         kelipatan 4 (ptr = first), karakter di luar alfabet, padding di
+ *         tengah, atau bit sisa tidak nol (ptr = karakter tersebut)
+ */
+constexpr std::from_chars_result base64_decode(const char* first, const char* last, uint8_t* out) noexcept {
+    using namespace detail::encoding;
+    const size_t len = static_cast<size_t>(last - first);
+    if (len % 4 != 0) return {first, std::errc::invalid_argument};
+    if (len == 0) return {last, std::errc{}};
+
+    // Semua quad kecuali yang terakhir tidak boleh berisi padding
+    const size_t body = len - 4;
+    size_t done = 0;
+    if (!std::is_constant_evaluated() && body >= dispatch_threshold) {
+        if (const auto fn = select().base64_decode) done = fn(first, body, out);
+    }
+    if (const char* bad_char = base64_decode_scalar(first + done, (body - done) / 4, out + done / 4 * 3))
+        return {bad_char, std::errc::invalid_argument};
+
+    const char* q = first + body;
+    uint8_t* o = out + body / 4 * 3;
+    const size_t pad = q[3] != '=' ? 0 : (q[2] == '=' ? 2 : 1);
+    uint8_t v[4]{};
+    for (size_t k = 0; k < 4 - pad; ++k) {
+        v[k] = base64_values[static_cast<uint8_t>(q[k])];
+        if (v[k] == bad) return {q + k, std::errc::invalid_argument};
+    }
+    o[0] = static_cast<uint8_t>((v[0] << 2) | (v[1] >> 4));
+    if (pad == 2) {
+        if (v[1] & 0x0F) return {q + 1, std::errc::invalid_argument};
+    } else {
+        o[1] = static_cast<uint8_t>((v[1] << 4) | (v[2] >> 2));
+        if (pad == 1) {
+            if (v[2] & 0x03) return {q + 2, std::errc::invalid_argument};
+        } else {
+            o[2] = static_cast<uint8_t>((v[2] << 6) | v[3]);
+        }
+    }
+    return {last, std::errc{}};
+}
+
+// ============= bytes<N> =============
+
+/** @brief Hex dari bytes<N> (byte 0 lebih dulu), constexpr */
+template <size_t N>
+[[nodiscard]] constexpr encoded_chars<N * 2> to_hex(const bytes<N>& b, hex_case c = hex_case::lower) noexcept {
+    encoded_chars<N * 2> r;
+    hex_encode(b.data(), N, r.chars, c);
+    return r;
+}
+
+/** @brief Base64 dari bytes<N>, constexpr */
+template <size_t N>
+[[nodiscard]] constexpr encoded_chars<base64_encoded_size(N)> to_base64(const bytes<N>& b) noexcept {
+    encoded_chars<base64_encoded_size(N)> r;
+    base64_encode(b.data(), N, r.chars);
+    return r;
+}
+
+/**
+ * @brief Parse tepat 2N karakter hex ke value
+ * @note value tidak berubah jika gagal
+ */
+template <size_t N>
+constexpr std::from_chars_result from_hex(std::string_view s, bytes<N>& value) noexcept {
+    if (s.size() != N * 2) return {s.data(), std::errc::invalid_argument};
+    bytes<N> tmp;
+    const auto res = hex_decode(s.data(), s.data() + s.size(), tmp.data());
+    if (res.ec == std::errc{}) value = tmp;
+    return res;
+}
+
+/**
+ * @brief Parse base64 yang decode ke tepat N byte
+ * @note value tidak berubah jika gagal
+ */
+template <size_t N>
+constexpr std::from_chars_result from_base64(std::string_view s, bytes<N>& value) noexcept {
+    if (s.size() != base64_encoded_size(N) || base64_decoded_size(s) != N)
+        return {s.data(), std::errc::invalid_argument};
+    bytes<N> tmp;
+    const auto res = base64_decode(s.data(), s.data() + s.size(), tmp.data());
+    if (res.ec == std::errc{}) value = tmp;
+    return res;
+}
+
+// ============= Buffer API =============
+
+[[nodiscard]] inline std::string to_hex(bytes_view v, hex_case c = hex_case::lower) {
+    std::string s(hex_encoded_size(v.size()), '\0');
+    hex_encode(v.data(), v.size(), s.data(), c);
+    return s;
+}
+
+[[nodiscard]] inline std::string to_base64(bytes_view v) {
+    std::string s(base64_encoded_size(v.size()), '\0');
+    base64_encode(v.data(), v.size(), s.data());
+    return s;
+}
+
+/** @brief Decode hex ke out (di-resize); out kosong jika gagal */
+inline std::from_chars_result from_hex(std::string_view s, byte_buffer& out) {
+    out.resize(hex_decoded_size(s.size()));
+    const auto res = hex_decode(s.data(), s.data() + s.size(), out.data());
+    if (res.ec != std::errc{}) out.resize(0);
+    return res;
+}
+
+/** @brief Decode base64 ke out (di-resize); out kosong jika gagal */
+inline std::from_chars_result from_base64(std::string_view s, byte_buffer& out) {
+    out.resize(base64_decoded_size(s));
+    const auto res = base64_decode(s.data(), s.data() + s.size(), out.data());
+    if (res.ec != std::errc{}) out.resize(0);
+    return res;
+}
+
+} // namespace zuu
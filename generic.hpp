@@ -102,6 +102,8 @@ public:
     static constexpr index_type npos = detail::npos<index_type>;
 
 private:
+    static constexpr size_t type_sizes_[] = {sizeof(Ts)...};
+
     // Storage dengan alignment yang benar
     alignas(max_align) uint8_t data_[max_size]{};
     index_type index_ = npos;
@@ -205,6 +207,21 @@ public:
         return *this;
     }
 
+    /**
+     * @brief Construct alternatif ke-i dari raw bytes (index runtime)
+     * @param i Index tipe (mis. dari index_from_name)
+     * @param data Representasi byte dari value
+     * @param len Jumlah byte; dipotong ke sizeof tipe, sisa diisi nol
+     * @throws std::bad_cast jika i bukan index valid
+     */
+    constexpr void emplace_by_index(size_t i, const uint8_t* data, size_t len) {
+        if (i >= type_count) throw std::bad_cast();
+        const size_t n = len < type_sizes_[i] ? len : type_sizes_[i];
+        std::memset(data_, 0, max_size);
+        std::memcpy(data_, data, n);
+        index_ = static_cast<index_type>(i);
+    }
+
     /** @brief Reset ke valueless state */
     constexpr void reset() noexcept {
         index_ = npos;
@@ -0,0 +1,462 @@
+#pragma once
+
+/**
+ * @file hamming.hpp
+ * @brief Jarak Hamming dan pencarian nearest-neighbour untuk bytes<N>
+ * @version 1.0.0
+ *
+ * Untuk embedding biner dan fingerprint SimHash (bytes<32>, bytes<64>).
+ *
+ * Menyediakan:
+ * - hamming(a, b): XOR + popcount per limb 64-bit (constexpr)
+ * - hamming_many: jarak query ke banyak vektor, kernel AVX-512 VPOPCNTDQ /
+ *   AVX2 (pshufb nibble LUT + psadbw) / POPCNT dipilih sekali
+ * - hamming_topk: k terdekat dengan brute force, multithread
+ * - mih_index: multi-index hashing, pencarian sublinear untuk radius kecil
+ *
+ * @example
+ * ```cpp
+ * std::vector<bytes<32>> codes = ...;
+ * auto top = hamming_topk(q, std::span<const bytes<32>>(codes), 10, 0);
+ * for (auto [dist, idx] : top) { ... }            // urut naik (jarak, index)
+ *
+ * mih_index<32> mih(codes, 8);                    // 8 substring 32 bit
+ * auto near = mih.topk(q, 10);                    // hasil sama dengan brute force
+ * ```
+ */
+
+#include "bytes.hpp"
+#include "bytes_map.hpp"
+#include "radix_sort.hpp"
+#include "simd.hpp"
+#include <algorithm>
+#include <bit>
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace zuu {
+
+// ============= Distance =============
+
+/** @brief Jumlah bit berbeda antara a dan b */
+template <size_t N>
+[[nodiscard]] constexpr size_t hamming(const bytes<N>& a, const bytes<N>& b) noexcept {
+    size_t d = 0;
+    if (!std::is_constant_evaluated()) {
+        size_t i = 0;
+        for (; i + 8 <= N; i += 8) {
+            d += static_cast<size_t>(std::popcount(simd::load_u64(a.data() + i) ^ simd::load_u64(b.data() + i)));
+        }
+        for (; i < N; ++i) d += static_cast<size_t>(std::popcount(static_cast<uint8_t>(a[i] ^ b[i])));
+        return d;
+    }
+    for (size_t i = 0; i < N; ++i) d += static_cast<size_t>(std::popcount(static_cast<uint8_t>(a[i] ^ b[i])));
+    return d;
+}
+
+/** @brief Hasil pencarian: jarak dan index vektor di data */
+struct hamming_match {
+    uint32_t distance;
+    size_t index;
+
+    [[nodiscard]] constexpr bool operator==(const hamming_match&) const noexcept = default;
+    [[nodiscard]] constexpr auto operator<=>(const hamming_match&) const noexcept = default;
+};
+
+namespace detail::hamming {
+
+/**
+ * @brief out[i] = jarak len byte antara q dan base + i * stride, i < count
+ */
+using batch_fn = void (*)(const uint8_t* q, const uint8_t* base, size_t count, size_t len, size_t stride, uint32_t* out) noexcept;
+
+[[nodiscard]] inline uint32_t distance_words(const uint8_t* a, const uint8_t* b, size_t len) noexcept {
+    uint64_t d = 0;
+    size_t i = 0;
+    for (; i + 8 <= len; i += 8) d += static_cast<uint64_t>(std::popcount(simd::load_u64(a + i) ^ simd::load_u64(b + i)));
+    for (; i < len; ++i) d += static_cast<uint64_t>(std::popcount(static_cast<uint8_t>(a[i] ^ b[i])));
+    return static_cast<uint32_t>(d);
+}
+
+inline void batch_words(const uint8_t* q, const uint8_t* base, size_t count, size_t len, size_t stride, uint32_t* out) noexcept {
+    for (size_t i = 0; i < count; ++i) out[i] = distance_words(q, base + i * stride, len);
+}
+
+#ifdef ZUU_SIMD_X86
+
+ZUU_TARGET("popcnt")
+inline uint32_t distance_popcnt(const uint8_t* a, const uint8_t* b, size_t len) noexcept {
+    return distance_words(a, b, len);
+}
+
+ZUU_TARGET("popcnt")
+inline void batch_popcnt(const uint8_t* q, const uint8_t* base, size_t count, size_t len, size_t stride, uint32_t* out) noexcept {
+    for (size_t i = 0; i < count; ++i) out[i] = distance_popcnt(q, base + i * stride, len);
+}
+
+/** @brief Popcount per byte via LUT nibble (pshufb), dijumlah per lane dengan psadbw */
+ZUU_TARGET("avx2,popcnt")
+inline void batch_avx2(const uint8_t* q, const uint8_t* base, size_t count, size_t len, size_t stride, uint32_t* out) noexcept {
+    const __m256i lut = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                         0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low = _mm256_set1_epi8(0x0F);
+    const size_t full = len / 32 * 32;
+    for (size_t v = 0; v < count; ++v) {
+        const uint8_t* p = base + v * stride;
+        __m256i acc = _mm256_setzero_si256();
+        for (size_t i = 0; i < full; i += 32) {
+            const __m256i x = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(q + i)),
+                                               _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p + i)));
+            const __m256i c = _mm256_add_epi8(_mm256_shuffle_epi8(lut, _mm256_and_si256(x, low)),
+                                              _mm256_shuffle_epi8(lut, _mm256_and_si256(_mm256_srli_epi16(x, 4), low)));
+            acc = _mm256_add_epi64(acc, _mm256_sad_epu8(c, _mm256_setzero_si256()));
+        }
+        alignas(32) uint64_t lanes[4];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), acc);
+        const uint64_t d = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+        out[v] = static_cast<uint32_t>(d) + distance_popcnt(q + full, p + full, len - full);
+    }
+}
+
+ZUU_TARGET("avx512f,avx512vpopcntdq,popcnt")
+inline void batch_avx512(const uint8_t* q, const uint8_t* base, size_t count, size_t len, size_t stride, uint32_t* out) noexcept {
+    const size_t full = len / 64 * 64;
+    for (size_t v = 0; v < count; ++v) {
+        const uint8_t* p = base + v * stride;
+        __m512i acc = _mm512_setzero_si512();
+        for (size_t i = 0; i < full; i += 64) {
+            acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(
+                _mm512_xor_si512(_mm512_loadu_si512(q + i), _mm512_loadu_si512(p + i))));
+        }
+        alignas(64) uint64_t lanes[8];
+        _mm512_store_si512(lanes, acc);
+        uint64_t d = 0;
+        for (uint64_t l : lanes) d += l;
+        out[v] = static_cast<uint32_t>(d) + distance_popcnt(q + full, p + full, len - full);
+    }
+}
+
+#endif // ZUU_SIMD_X86
+
+/** @brief Kernel terbaik untuk vektor len byte */
+[[nodiscard]] inline batch_fn select_batch(size_t len) noexcept {
+#ifdef ZUU_SIMD_X86
+    const auto& f = simd::cpu();
+    if (f.avx512vpopcntdq && f.popcnt && len >= 64) return &batch_avx512;
+    if (f.avx2 && f.popcnt && len >= 32) return &batch_avx2;
+    if (f.popcnt) return &batch_popcnt;
+#endif
+    (void)len;
+    return &batch_words;
+}
+
+template <size_t N>
+void batch(const bytes<N>& q, const bytes<N>* base, size_t count, uint32_t* out) noexcept {
+    static const batch_fn fn = select_batch(N);
+    fn(q.data(), base->data(), count, N, sizeof(bytes<N>), out);
+}
+
+/** @brief Jumlah vektor per blok jarak (buffer di stack) */
+inline constexpr size_t block_size = 512;
+
+/** @brief Minimal vektor per thread agar thread tambahan sepadan */
+inline constexpr size_t parallel_grain = size_t{1} << 15;
+
+/**
+ * @brief Max-heap k terbaik: top() = kandidat terburuk yang masih disimpan
+ */
+class topk_heap {
+    std::vector<hamming_match> h_;
+    size_t k_;
+
+public:
+    explicit topk_heap(size_t k) : k_(k) { h_.reserve(k); }
+
+    /** @brief Jarak yang harus dikalahkan (inklusif) agar masuk */
+    [[nodiscard]] uint32_t bound() const noexcept {
+        return h_.size() < k_ ? UINT32_MAX : h_.front().distance;
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return h_.size(); }
+
+    void push(hamming_match m) {
+        if (h_.size() < k_) {
+            h_.push_back(m);
+            std::push_heap(h_.begin(), h_.end());
+        } else if (m < h_.front()) {
+            std::pop_heap(h_.begin(), h_.end());
+            h_.back() = m;
+            std::push_heap(h_.begin(), h_.end());
+        }
+    }
+
+    [[nodiscard]] std::vector<hamming_match> take() && { return std::move(h_); }
+};
+
+template <size_t N>
+void scan(const bytes<N>& q, const bytes<N>* data, size_t first, size_t last, topk_heap& heap) {
+    uint32_t dist[block_size];
+    for (size_t b = first; b < last; b += block_size) {
+        const size_t count = last - b < block_size ? last - b : block_size;
+        batch(q, data + b, count, dist);
+        uint32_t bound = heap.bound();
+        for (size_t i = 0; i < count; ++i) {
+            if (dist[i] > bound) continue;
+            heap.push({dist[i], b + i});
+            bound = heap.bound();
+        }
+    }
+}
+
+/** @brief Bit [pos, pos + width) dari limb little-endian (width <= 64) */
+[[nodiscard]] inline uint64_t bit_field(const uint64_t* limbs, size_t limb_count, size_t pos, size_t width) noexcept {
+    const size_t i = pos / 64, s = pos % 64;
+    uint64_t v = limbs[i] >> s;
+    if (s && i + 1 < limb_count) v |= limbs[i + 1] << (64 - s);
+    return width == 64 ? v : v & ((uint64_t{1} << width) - 1);
+}
+
+/** @brief C(n, r), jenuh di SIZE_MAX */
+[[nodiscard]] constexpr size_t choose(size_t n, size_t r) noexcept {
+    if (r > n) return 0;
+    if (r > n - r) r = n - r;
+    size_t c = 1;
+    for (size_t i = 1; i <= r; ++i) {
+        const size_t num = n - r + i;
+        if (c > SIZE_MAX / num) return SIZE_MAX;
+        c = c * num / i;
+    }
+    return c;
+}
+
+/** @brief Kombinasi r bit berikutnya dalam urutan naik (Gosper's hack) */
+[[nodiscard]] constexpr uint64_t next_combination(uint64_t v) noexcept {
+    const uint64_t t = v | (v - 1);
+    return (t + 1) | (((~t & (0 - ~t)) - 1) >> (std::countr_zero(v) + 1));
+}
+
+} // namespace detail::hamming
+
+// ============= Batched Distance =============
+
+/**
+ * @brief out[i] = hamming(q, data[i]) untuk i < min(data.size(), out.size())
+ */
+template <size_t N>
+void hamming_many(const bytes<N>& q, std::span<const bytes<N>> data, std::span<uint32_t> out) noexcept {
+    const size_t count = data.size() < out.size() ? data.size() : out.size();
+    if (count) detail::hamming::batch(q, data.data(), count, out.data());
+}
+
+// ============= Brute-Force Top-k =============
+
+/**
+ * @brief k vektor terdekat ke q, urut naik (jarak, index)
+ * @param threads 1 = sequential, 0 = std::thread::hardware_concurrency()
+ *
+ * Setiap thread memindai satu chunk dengan heap k terbaik sendiri; jarak
+ * dihitung per blok 512 vektor lalu hanya yang <= batas heap diproses.
+ */
+template <size_t N>
+[[nodiscard]] std::vector<hamming_match> hamming_topk(const bytes<N>& q, std::span<const bytes<N>> data,
+                                                      size_t k, unsigned threads = 1) {
+    using detail::hamming::topk_heap;
+    const size_t n = data.size();
+    if (k == 0 || n == 0) return {};
+    if (k > n) k = n;
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = static_cast<unsigned>(std::min<size_t>(threads, std::max<size_t>(1, n / detail::hamming::parallel_grain)));
+
+    std::vector<topk_heap> heaps(threads, topk_heap(k));
+    const size_t chunk = (n + threads - 1) / threads;
+    const auto work = [&](unsigned t) {
+        const size_t lo = std::min(n, chunk * t), hi = std::min(n, lo + chunk);
+        detail::hamming::scan(q, data.data(), lo, hi, heaps[t]);
+    };
+    std::vector<std::thread> pool;
+    pool.reserve(threads - 1);
+    for (unsigned t = 1; t < threads; ++t) pool.emplace_back(work, t);
+    work(0);
+    for (auto& th : pool) th.join();
+
+    for (unsigned t = 1; t < threads; ++t) {
+        for (const auto& m : std::move(heaps[t]).take()) heaps[0].push(m);
+    }
+    auto r = std::move(heaps[0]).take();
+    std::sort(r.begin(), r.end());
+    return r;
+}
+
+// ============= Multi-Index Hashing =============
+
+/**
+ * @brief Multi-index hashing (Norouzi dkk.) untuk kode bytes<N>
+ *
+ * Kode 8N bit dipecah menjadi m substring berurutan (bit 0 = bit 0 byte 0).
+ * Jika hamming(q, x) <= r maka minimal satu substring berjarak
+ * <= floor(r / m), sehingga cukup memeriksa bucket substring di sekitar
+ * substring query. Setiap tabel: bytes_map substring -> rentang id yang
+ * diurutkan dengan radix_sort.
+ *
+ * @note Non-owning: data harus hidup selama index dipakai
+ * @note Efektif jika 8N/m kira-kira log2(jumlah vektor); id 32-bit
+ */
+template <size_t N>
+class mih_index {
+    struct range {
+        uint32_t begin = 0;
+        uint32_t count = 0;
+    };
+
+    /** @brief Biaya satu probe tabel relatif terhadap satu jarak di scan linear */
+    static constexpr size_t probe_cost = 128;
+
+    std::span<const bytes<N>> data_;
+    size_t m_ = 0;
+    size_t width_ = 0;
+    std::vector<bytes_map<8, range>> tables_;
+    std::vector<std::vector<uint32_t>> ids_;
+
+    [[nodiscard]] uint64_t substring(const typename bytes<N>::limb_array& limbs, size_t j) const noexcept {
+        return detail::hamming::bit_field(limbs.w, bytes<N>::limb_count, j * width_, width_);
+    }
+
+    /** @brief Panggil f(id) untuk setiap id di tabel j dengan substring key */
+    template <typename F>
+    void probe(size_t j, uint64_t key, F&& f) const {
+        if (const range* r = tables_[j].find(bytes<8>(key))) {
+            const uint32_t* ids = ids_[j].data() + r->begin;
+            for (uint32_t i = 0; i < r->count; ++i) f(ids[i]);
+        }
+    }
+
+    /** @brief Panggil f(id) untuk semua substring tabel j berjarak tepat s dari key */
+    template <typename F>
+    void probe_shell(size_t j, uint64_t key, size_t s, F&& f) const {
+        if (s == 0) {
+            probe(j, key, f);
+            return;
+        }
+        const uint64_t ones = s == 64 ? ~uint64_t{0} : (uint64_t{1} << s) - 1;
+        const uint64_t last = ones << (width_ - s);
+        for (uint64_t flip = ones;; flip = detail::hamming::next_combination(flip)) {
+            probe(j, key ^ flip, f);
+            if (flip == last) break;
+        }
+    }
+
+    /** @brief Tabel j: id diurutkan per substring, bytes_map substring -> rentang */
+    void build_table(size_t j) {
+        const size_t n = data_.size();
+        std::vector<uint64_t> keys(n);
+        auto& ids = ids_[j];
+        ids.resize(n);
+        for (size_t i = 0; i < n; ++i) {
+            keys[i] = substring(data_[i].to_limbs(), j);
+            ids[i] = static_cast<uint32_t>(i);
+        }
+        radix_sort(std::span<uint64_t>(keys), std::span<uint32_t>(ids));
+
+        size_t distinct = n ? 1 : 0;
+        for (size_t i = 1; i < n; ++i) distinct += keys[i] != keys[i - 1];
+        auto& table = tables_[j];
+        table.reserve(distinct);
+        for (size_t i = 0; i < n;) {
+            size_t e = i + 1;
+            while (e < n && keys[e] == keys[i]) ++e;
+            table.try_emplace(bytes<8>(keys[i]), range{static_cast<uint32_t>(i), static_cast<uint32_t>(e - i)});
+            i = e;
+        }
+    }
+
+public:
+    /**
+     * @param data    Vektor yang diindeks (tidak disalin)
+     * @param m       Jumlah substring; 8N harus habis dibagi m, lebar <= 64 bit
+     * @param threads Thread untuk membangun tabel (0 = hardware_concurrency)
+     * @throws std::invalid_argument jika m tidak valid atau data >= 2^32
+     */
+    mih_index(std::span<const bytes<N>> data, size_t m, unsigned threads = 1) : data_(data), m_(m) {
+        if (m == 0 || (N * 8) % m != 0 || (N * 8) / m > 64) {
+            throw std::invalid_argument("mih_index: 8N must be divisible by m with substrings <= 64 bits");
+        }
+        if (data.size() >= UINT32_MAX) throw std::invalid_argument("mih_index: too many vectors");
+        width_ = (N * 8) / m;
+        tables_.resize(m);
+        ids_.resize(m);
+
+        if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+        if (threads > m) threads = static_cast<unsigned>(m);
+        std::vector<std::thread> pool;
+        pool.reserve(threads - 1);
+        for (unsigned t = 1; t < threads; ++t) {
+            pool.emplace_back([this, t, threads] {
+                for (size_t j = t; j < m_; j += threads) build_table(j);
+            });
+        }
+        for (size_t j = 0; j < m_; j += threads) build_table(j);
+        for (auto& th : pool) th.join();
+    }
+
+    [[nodiscard]] size_t size() const noexcept { return data_.size(); }
+    [[nodiscard]] size_t substrings() const noexcept { return m_; }
+    [[nodiscard]] size_t substring_bits() const noexcept { return width_; }
+
+    /**
+     * @brief Semua vektor dengan hamming(q, x) <= r, urut naik (jarak, index)
+     */
+    [[nodiscard]] std::vector<hamming_match> search_radius(const bytes<N>& q, size_t r) const {
+        const auto ql = q.to_limbs();
+        std::vector<hamming_match> out;
+        const size_t s_max = std::min(r / m_, width_);
+        for (size_t j = 0; j < m_; ++j) {
+            const uint64_t key = substring(ql, j);
+            for (size_t s = 0; s <= s_max; ++s) {
+                probe_shell(j, key, s, [&](uint32_t id) {
+                    const size_t d = hamming(q, data_[id]);
+                    if (d <= r) out.push_back({static_cast<uint32_t>(d), id});
+                });
+            }
+        }
+        std::sort(out.begin(), out.end());
+        out.erase(std::unique(out.begin(), out.end()), out.end());
+        return out;
+    }
+
+    /**
+     * @brief k vektor terdekat (hasil sama dengan hamming_topk)
+     *
+     * Radius substring s dinaikkan bertahap. Setelah semua tabel diperiksa
+     * sampai s, vektor yang belum terlihat berjarak >= m(s + 1); pencarian
+     * berhenti begitu k kandidat terbaik berjarak < m(s + 1). Jika jumlah
+     * probe shell berikutnya melebihi biaya scan linear (tetangga ke-k jauh),
+     * hasil diambil dari hamming_topk.
+     */
+    [[nodiscard]] std::vector<hamming_match> topk(const bytes<N>& q, size_t k) const {
+        const size_t n = data_.size();
+        if (k == 0 || n == 0) return {};
+        if (k > n) k = n;
+        const auto ql = q.to_limbs();
+        detail::hamming::topk_heap heap(k);
+        bytes_map<8, uint8_t> seen;
+        for (size_t s = 0; s <= width_; ++s) {
+            const size_t probes = detail::hamming::choose(width_, s);
+            if (probes > n / (m_ * probe_cost)) return hamming_topk(q, data_, k);
+            for (size_t j = 0; j < m_; ++j) {
+                probe_shell(j, substring(ql, j), s, [&](uint32_t id) {
+                    if (!seen.try_emplace(bytes<8>(uint64_t{id})).second) return;
+                    heap.push({static_cast<uint32_t>(hamming(q, data_[id])), id});
+                });
+            }
+            if (heap.size() == k && heap.bound() < m_ * (s + 1)) break;
+        }
+        auto r = std::move(heap).take();
+        std::sort(r.begin(), r.end());
+        return r;
+    }
+};
+
+} // namespace zuu
@@ -0,0 +1,225 @@
+#pragma once
+
+/**
+ * @file morton.hpp
+ * @brief Kode Morton (Z-order): interleave koordinat Dims dimensi ke bytes<N>
+ * @version 1.0.0
+ *
+ * Bit ke-i koordinat d ditaruh di bit (i * Dims + d) dari key (urutan bit
+ * bytes::test_bit), sehingga perbandingan numeric_order atas key = urutan
+ * Z-order. Setiap koordinat memakai morton_bits<Dims, N> = 8N / Dims bit;
+ * bit di atasnya dibuang.
+ *
+ * Menyediakan:
+ * - interleave<Dims>(coords...) -> bytes<N> (default N = 8)
+ * - deinterleave<Dims>(key) -> std::array<uint64_t, Dims>
+ *
+ * Per limb 64-bit: satu pdep / pext per koordinat jika BMI2 cepat di CPU ini,
+ * selain itu spread "magic number" (log2 langkah shift + mask) yang juga
+ * dipakai saat constexpr.
+ *
+ * @example
+ * ```cpp
+ * bytes<8> k2 = interleave<2>(x, y);               // 32 bit per koordinat
+ * bytes<16> k3 = interleave<3, 16>(x, y, z);       // 42 bit per koordinat
+ * auto [x2, y2] = deinterleave<2>(k2);
+ * bool before = k2.compare<numeric_order>(other) < 0;
+ * ```
+ */
+
+#include "bytes.hpp"
+#include "simd.hpp"
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+
+namespace zuu {
+
+/** @brief Bit per koordinat untuk key Dims dimensi di bytes<N> */
+template <size_t Dims, size_t N>
+inline constexpr unsigned morton_bits = static_cast<unsigned>(8 * N / Dims);
+
+/** @brief Dims >= 2 dan setiap koordinat muat di uint64_t */
+template <size_t Dims, size_t N>
+concept morton_layout = Dims >= 2 && N >= 1 && morton_bits<Dims, N> >= 1 && morton_bits<Dims, N> <= 64;
+
+namespace detail::morton {
+
+[[nodiscard]] constexpr uint64_t low_mask(unsigned n) noexcept {
+    return n >= 64 ? ~uint64_t{0} : (uint64_t{1} << n) - 1;
+}
+
+/**
+ * @brief Bagian koordinat d yang jatuh di satu limb key
+ *
+ * Bit koordinat [first, first + count) menempati bit offset + j * Dims
+ * (j < count) di limb tersebut; mask = posisi-posisi itu (untuk pdep/pext).
+ */
+struct part {
+    uint64_t mask = 0;
+    unsigned first = 0;
+    unsigned count = 0;
+    unsigned offset = 0;
+};
+
+template <size_t Dims, size_t N>
+struct layout {
+    static constexpr size_t limbs = (N + 7) / 8;
+
+    part parts[Dims][limbs]{};
+
+    constexpr layout() {
+        for (size_t d = 0; d < Dims; ++d) {
+            for (unsigned i = 0; i < morton_bits<Dims, N>; ++i) {
+                const size_t p = i * Dims + d;
+                part& q = parts[d][p / 64];
+                if (q.count == 0) {
+                    q.first = i;
+                    q.offset = static_cast<unsigned>(p % 64);
+                }
+                q.mask |= uint64_t{1} << (p % 64);
+                ++q.count;
+            }
+        }
+    }
+};
+
+/**
+ * @brief Mask spread: bit j -> bit j * Dims untuk j < width
+ *
+ * mask[t] = blok 2^t bit dengan jarak 2^t * Dims. spread berjalan dari blok
+ * terbesar ke 1, compact sebaliknya.
+ */
+template <size_t Dims>
+struct spread_plan {
+    static constexpr unsigned width = static_cast<unsigned>((64 + Dims - 1) / Dims);
+    static constexpr unsigned steps = static_cast<unsigned>(std::bit_width(width - 1));
+
+    uint64_t mask[steps + 1]{};
+
+    constexpr spread_plan() {
+        for (unsigned t = 0; t <= steps; ++t) {
+            const size_t s = size_t{1} << t;
+            for (size_t pos = 0; pos < 64; pos += s * Dims) mask[t] |= low_mask(static_cast<unsigned>(s)) << pos;
+        }
+    }
+};
+
+template <size_t Dims>
+inline constexpr spread_plan<Dims> plan{};
+
+/** @brief Bit j dari x (j < spread_plan::width) -> bit j * Dims */
+template <size_t Dims>
+[[nodiscard]] constexpr uint64_t spread(uint64_t x) noexcept {
+    for (unsigned t = spread_plan<Dims>::steps; t-- > 0;)
+        x = (x | (x << ((size_t{1} << t) * (Dims - 1)))) & plan<Dims>.mask[t];
+    return x;
+}
+
+/** @brief Kebalikan spread: bit j * Dims -> bit j */
+template <size_t Dims>
+[[nodiscard]] constexpr uint64_t compact(uint64_t x) noexcept {
+    x &= plan<Dims>.mask[0];
+    for (unsigned t = 0; t < spread_plan<Dims>::steps; ++t)
+        x = (x | (x >> ((size_t{1} << t) * (Dims - 1)))) & plan<Dims>.mask[t + 1];
+    return x;
+}
+
+template <size_t Dims, size_t N>
+inline constexpr layout<Dims, N> layout_v{};
+
+template <size_t Dims, size_t N>
+constexpr void encode_spread(const uint64_t* c, uint64_t* w) noexcept {
+    for (size_t l = 0; l < layout<Dims, N>::limbs; ++l) {
+        uint64_t acc = 0;
+        for (size_t d = 0; d < Dims; ++d) {
+            const part& q = layout_v<Dims, N>.parts[d][l];
+            if (q.count) acc |= spread<Dims>((c[d] >> q.first) & low_mask(q.count)) << q.offset;
+        }
+        w[l] = acc;
+    }
+}
+
+template <size_t Dims, size_t N>
+constexpr void decode_compact(const uint64_t* w, uint64_t* c) noexcept {
+    for (size_t d = 0; d < Dims; ++d) {
+        uint64_t acc = 0;
+        for (size_t l = 0; l < layout<Dims, N>::limbs; ++l) {
+            const part& q = layout_v<Dims, N>.parts[d][l];
+            if (q.count) acc |= (compact<Dims>(w[l] >> q.offset) & low_mask(q.count)) << q.first;
+        }
+        c[d] = acc;
+    }
+}
+
+#if defined(ZUU_SIMD_X86) && defined(__x86_64__)
+
+template <size_t Dims, size_t N>
+ZUU_TARGET("bmi2")
+inline void encode_bmi2(const uint64_t* c, uint64_t* w) noexcept {
+    for (size_t l = 0; l < layout<Dims, N>::limbs; ++l) {
+        uint64_t acc = 0;
+        for (size_t d = 0; d < Dims; ++d) {
+            const part& q = layout_v<Dims, N>.parts[d][l];
+            if (q.count) acc |= _pdep_u64(c[d] >> q.first, q.mask);
+        }
+        w[l] = acc;
+    }
+}
+
+template <size_t Dims, size_t N>
+ZUU_TARGET("bmi2")
+inline void decode_bmi2(const uint64_t* w, uint64_t* c) noexcept {
+    for (size_t d = 0; d < Dims; ++d) {
+        uint64_t acc = 0;
+        for (size_t l = 0; l < layout<Dims, N>::limbs; ++l) {
+            const part& q = layout_v<Dims, N>.parts[d][l];
+            if (q.count) acc |= _pext_u64(w[l], q.mask) << q.first;
+        }
+        c[d] = acc;
+    }
+}
+
+#endif
+
+} // namespace detail::morton
+
+// ============= Interleave =============
+
+/**
+ * @brief Key Morton dari Dims koordinat (koordinat pertama = bit 0)
+ * @tparam N Ukuran key dalam byte; morton_bits<Dims, N> bit per koordinat
+ */
+template <size_t Dims, size_t N = 8, std::integral... C>
+requires (sizeof...(C) == Dims && morton_layout<Dims, N>)
+[[nodiscard]] constexpr bytes<N> interleave(C... coords) noexcept {
+    const uint64_t c[Dims] = {static_cast<uint64_t>(coords)...};
+    typename bytes<N>::limb_array w{};
+#if defined(ZUU_SIMD_X86) && defined(__x86_64__)
+    if (!std::is_constant_evaluated() && simd::cpu().fast_pdep) {
+        detail::morton::encode_bmi2<Dims, N>(c, w.w);
+        return bytes<N>::from_limbs(w);
+    }
+#endif
+    detail::morton::encode_spread<Dims, N>(c, w.w);
+    return bytes<N>::from_limbs(w);
+}
+
+/** @brief Kebalikan interleave: koordinat ke-d dari key */
+template <size_t Dims, size_t N>
+requires morton_layout<Dims, N>
+[[nodiscard]] constexpr std::array<uint64_t, Dims> deinterleave(const bytes<N>& key) noexcept {
+    const typename bytes<N>::limb_array w = key.to_limbs();
+    std::array<uint64_t, Dims> c{};
+#if defined(ZUU_SIMD_X86) && defined(__x86_64__)
+    if (!std::is_constant_evaluated() && simd::cpu().fast_pdep) {
+        detail::morton::decode_bmi2<Dims, N>(w.w, c.data());
+        return c;
+    }
+#endif
+    detail::morton::decode_compact<Dims, N>(w.w, c.data());
+    return c;
+}
+
+} // namespace zuu
@@ -0,0 +1,291 @@
+#pragma once
+
+/**
+ * @file packed_array.hpp
+ * @brief Array integer bit-packed dengan lebar tetap Bits (1..32)
+ * @version 1.0.0
+ *
+ * Nilai ke-i menempati bit [i * Bits, (i + 1) * Bits) dari byte_buffer
+ * (little-endian, tanpa padding antar nilai). Akses acak = satu load 64-bit
+ * unaligned + shift + mask; buffer selalu punya 8 byte slack nol di akhir.
+ *
+ * Menyediakan:
+ * - get / set / push_back untuk akses acak
+ * - pack / unpack bulk: unpack memakai kernel AVX2 (pshufb + vpsrlvd,
+ *   8 nilai per Bits byte, gaya BP128) untuk Bits <= 25, dipilih sekali
+ * - Frame-of-reference: nilai disimpan sebagai v - base, get() = base + x
+ *
+ * @example
+ * ```cpp
+ * std::vector<uint32_t> ids = ...;          // semua < 2^17
+ * packed_array<17> a;
+ * a.pack(ids);                              // 17 bit per nilai
+ * uint32_t x = a[12345];
+ * a.unpack(out);                            // bulk decode
+ *
+ * packed_array<12> f;
+ * f.pack_for(timestamps);                   // base = min, simpan selisih
+ * ```
+ */
+
+#include "byte_buffer.hpp"
+#include "simd.hpp"
+#include <bit>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+
+namespace zuu {
+
+namespace detail::packed {
+
+/** @brief Byte slack setelah data agar load 64-bit di nilai terakhir aman */
+inline constexpr size_t slack = 8;
+
+/** @brief Lebar bit minimum untuk menyimpan v (0 -> 0) */
+[[nodiscard]] constexpr unsigned bit_width(uint32_t v) noexcept {
+    return static_cast<unsigned>(std::bit_width(v));
+}
+
+template <unsigned Bits>
+[[nodiscard]] constexpr uint64_t mask() noexcept { return (uint64_t{1} << Bits) - 1; }
+
+[[nodiscard]] constexpr size_t data_bytes(size_t n, unsigned bits) noexcept { return (n * bits + 7) / 8; }
+
+template <unsigned Bits>
+[[nodiscard]] inline uint32_t get(const uint8_t* d, size_t i) noexcept {
+    const size_t p = i * Bits;
+    return static_cast<uint32_t>((load_le64(d + p / 8) >> (p % 8)) & mask<Bits>());
+}
+
+template <unsigned Bits>
+inline void set(uint8_t* d, size_t i, uint32_t v) noexcept {
+    const size_t p = i * Bits;
+    const uint64_t m = mask<Bits>() << (p % 8);
+    const uint64_t w = load_le64(d + p / 8);
+    store_le64(d + p / 8, (w & ~m) | ((static_cast<uint64_t>(v) << (p % 8)) & m));
+}
+
+// ============= Unpack Kernels =============
+
+/** @brief out[j] = base + nilai ke-(first + j), j < n */
+using unpack_fn = void (*)(const uint8_t* d, size_t avail, size_t first, size_t n, uint32_t base, uint32_t* out) noexcept;
+
+template <unsigned Bits>
+inline void unpack_scalar(const uint8_t* d, size_t, size_t first, size_t n, uint32_t base, uint32_t* out) noexcept {
+    for (size_t j = 0; j < n; ++j) out[j] = base + get<Bits>(d, first + j);
+}
+
+#ifdef ZUU_SIMD_X86
+
+/**
+ * @brief Kontrol pshufb dan shift untuk satu grup 8 nilai (Bits byte)
+ *
+ * Lane 0..3 dibaca dari 16 byte di awal grup, lane 4..7 dari 16 byte mulai
+ * byte (4 * Bits) / 8; setiap lane mengambil 4 byte lalu vpsrlvd (bit % 8).
+ */
+template <unsigned Bits>
+struct unpack_plan {
+    alignas(32) uint8_t shuffle[32]{};
+    alignas(32) uint32_t shift[8]{};
+    size_t hi_offset = 0;
+
+    constexpr unpack_plan() {
+        hi_offset = (4 * Bits) / 8;
+        for (unsigned i = 0; i < 8; ++i) {
+            const unsigned bit = i * Bits;
+            const unsigned rel = bit / 8 - (i < 4 ? 0u : static_cast<unsigned>(hi_offset));
+            for (unsigned b = 0; b < 4; ++b) shuffle[i * 4 + b] = static_cast<uint8_t>(rel + b);
+            shift[i] = bit % 8;
+        }
+    }
+};
+
+template <unsigned Bits>
+ZUU_TARGET("avx2")
+inline void unpack_avx2(const uint8_t* d, size_t avail, size_t first, size_t n, uint32_t base, uint32_t* out) noexcept {
+    static constexpr unpack_plan<Bits> plan{};
+    // Nilai sebelum batas grup 8 diproses scalar
+    size_t j = 0;
+    for (; j < n && (first + j) % 8 != 0; ++j) out[j] = base + get<Bits>(d, first + j);
+
+    const __m256i shuf = _mm256_load_si256(reinterpret_cast<const __m256i*>(plan.shuffle));
+    const __m256i shift = _mm256_load_si256(reinterpret_cast<const __m256i*>(plan.shift));
+    const __m256i m = _mm256_set1_epi32(static_cast<int>(mask<Bits>()));
+    const __m256i b = _mm256_set1_epi32(static_cast<int>(base));
+    for (; j + 8 <= n; j += 8) {
+        const uint8_t* g = d + (first + j) / 8 * Bits;
+        if (static_cast<size_t>(g - d) + plan.hi_offset + 16 > avail) break;
+        const __m256i raw = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(g))),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(g + plan.hi_offset)), 1);
+        const __m256i v = _mm256_and_si256(_mm256_srlv_epi32(_mm256_shuffle_epi8(raw, shuf), shift), m);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + j), _mm256_add_epi32(v, b));
+    }
+    for (; j < n; ++j) out[j] = base + get<Bits>(d, first + j);
+}
+
+#endif // ZUU_SIMD_X86
+
+template <unsigned Bits>
+[[nodiscard]] inline unpack_fn select_unpack() noexcept {
+#ifdef ZUU_SIMD_X86
+    if constexpr (Bits <= 25) {
+        if (is_little_endian && simd::cpu().avx2) return &unpack_avx2<Bits>;
+    }
+#endif
+    return &unpack_scalar<Bits>;
+}
+
+} // namespace detail::packed
+
+/** @brief Lebar bit minimum agar semua (v - base) muat; 0 jika kosong */
+[[nodiscard]] inline unsigned bits_required(std::span<const uint32_t> values, uint32_t base = 0) noexcept {
+    uint32_t acc = 0;
+    for (uint32_t v : values) acc |= v - base;
+    return detail::packed::bit_width(acc);
+}
+
+// ============= Packed Array =============
+
+/**
+ * @brief Array nilai unsigned Bits-bit yang disimpan rapat
+ * @tparam Bits Lebar per nilai, 1..32
+ *
+ * Memory: ceil(size() * Bits / 8) + 8 byte. Nilai yang melebihi Bits bit
+ * dipotong (bit atas dibuang) oleh set / push_back / pack.
+ */
+template <unsigned Bits>
+requires (Bits >= 1 && Bits <= 32)
+class packed_array {
+public:
+    using value_type = uint32_t;
+    using size_type = size_t;
+
+    static constexpr unsigned bits = Bits;
+    static constexpr value_type max_value = static_cast<value_type>(detail::packed::mask<Bits>());
+
+private:
+    byte_buffer data_{detail::packed::slack};
+    size_type size_ = 0;
+    value_type base_ = 0;
+
+    /** @brief Nolkan bit [from_bit, akhir buffer) */
+    void clear_from(size_t from_bit) noexcept {
+        uint8_t* d = data_.data();
+        size_t byte = from_bit / 8;
+        if (from_bit % 8) d[byte++] &= static_cast<uint8_t>((1u << (from_bit % 8)) - 1);
+        if (byte < data_.size()) std::memset(d + byte, 0, data_.size() - byte);
+    }
+
+public:
+    // ============= Constructors =============
+
+    packed_array() = default;
+
+    /** @brief n nilai, semua = base */
+    explicit packed_array(size_type n, value_type base = 0) : base_(base) { resize(n); }
+
+    explicit packed_array(std::span<const uint32_t> values, value_type base = 0) { pack(values, base); }
+
+    // ============= Capacity =============
+
+    [[nodiscard]] size_type size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    /** @brief Frame-of-reference: nilai tersimpan = nilai - base */
+    [[nodiscard]] value_type base() const noexcept { return base_; }
+
+    /** @brief Byte data rapat (tanpa slack) */
+    [[nodiscard]] size_type size_bytes() const noexcept { return detail::packed::data_bytes(size_, Bits); }
+
+    /** @brief Data rapat sebagai view (untuk serialisasi) */
+    [[nodiscard]] bytes_view packed_bytes() const noexcept { return bytes_view(data_.data(), size_bytes()); }
+
+    void reserve(size_type n) { data_.reserve(detail::packed::data_bytes(n, Bits) + detail::packed::slack); }
+
+    /** @brief Ubah ukuran; nilai baru = base */
+    void resize(size_type n) {
+        if (n < size_) clear_from(n * Bits);
+        data_.resize(detail::packed::data_bytes(n, Bits) + detail::packed::slack);
+        size_ = n;
+    }
+
+    void clear() noexcept {
+        clear_from(0);
+        size_ = 0;
+    }
+
+    // ============= Element Access =============
+
+    [[nodiscard]] value_type get(size_type i) const noexcept {
+        return base_ + detail::packed::get<Bits>(data_.data(), i);
+    }
+
+    [[nodiscard]] value_type operator[](size_type i) const noexcept { return get(i); }
+
+    void set(size_type i, value_type v) noexcept { detail::packed::set<Bits>(data_.data(), i, v - base_); }
+
+    void push_back(value_type v) {
+        const size_type i = size_;
+        resize(size_ + 1);
+        set(i, v);
+    }
+
+    // ============= Bulk =============
+
+    /**
+     * @brief Ganti isi dengan values (disimpan sebagai v - base)
+     * @note Bit buffer 64-bit: satu store 8 byte setiap 64 bit keluaran
+     */
+    void pack(std::span<const uint32_t> values, value_type base = 0) {
+        base_ = base;
+        size_ = 0;
+        data_.resize(0);
+        resize(values.size());
+        uint8_t* out = data_.data();
+        uint64_t acc = 0;
+        unsigned filled = 0;
+        for (uint32_t v : values) {
+            const uint64_t x = static_cast<uint64_t>(v - base) & detail::packed::mask<Bits>();
+            acc |= x << filled;
+            filled += Bits;
+            if (filled >= 64) {
+                detail::store_le64(out, acc);
+                out += 8;
+                filled -= 64;
+                acc = filled ? x >> (Bits - filled) : 0;
+            }
+        }
+        if (filled) detail::store_le64(out, acc);
+    }
+
+    /**
+     * @brief Pack dengan base = min(values) (frame-of-reference)
+     * @throws std::invalid_argument jika max - min tidak muat dalam Bits bit
+     */
+    void pack_for(std::span<const uint32_t> values) {
+        uint32_t lo = values.empty() ? 0 : values[0], hi = lo;
+        for (uint32_t v : values) {
+            lo = v < lo ? v : lo;
+            hi = v > hi ? v : hi;
+        }
+        if (hi - lo > max_value) throw std::invalid_argument("packed_array: value range exceeds Bits");
+        pack(values, lo);
+    }
+
+    /**
+     * @brief out[j] = get(first + j) untuk j < min(out.size(), size() - first)
+     * @return Jumlah nilai yang ditulis
+     */
+    size_type unpack(std::span<uint32_t> out, size_type first = 0) const noexcept {
+        static const detail::packed::unpack_fn fn = detail::packed::select_unpack<Bits>();
+        if (first >= size_) return 0;
+        const size_type n = out.size() < size_ - first ? out.size() : size_ - first;
+        fn(data_.data(), data_.size(), first, n, base_, out.data());
+        return n;
+    }
+};
+
+} // namespace zuu
@@ -0,0 +1,222 @@
+#pragma once
+
+/**
+ * @file packed_tuple.hpp
+ * @brief Tuple trivially copyable dengan padding minimal
+ * @version 1.0.0
+ *
+ * Member disusun ulang berdasarkan alignment (descending) saat compile-time,
+ * sehingga padding hanya tersisa di akhir struct. Akses tetap memakai index
+ * urutan asli.
+ *
+ * @note Semua tipe harus trivially copyable
+ */
+
+#include "typelist.hpp"
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace zuu {
+
+namespace detail {
+
+/**
+ * @brief Layout packed untuk Ts... (urut berdasarkan alignment descending)
+ *
+ * Karena sizeof(T) selalu kelipatan alignof(T), menyusun member dari
+ * alignment terbesar ke terkecil menghilangkan semua padding internal.
+ */
+template <typename... Ts>
+struct packed_layout {
+    static constexpr size_t count = sizeof...(Ts);
+    static constexpr size_t align = type_list_t<Ts...>::max_align;
+
+    struct table { size_t value[count]; };
+
+    /** @brief order.value[k] = index asli dari member di slot k */
+    static constexpr table order = [] {
+        constexpr size_t aligns[] = {alignof(Ts)...};
+        table r{};
+        for (size_t i = 0; i < count; ++i) r.value[i] = i;
+        // Stable insertion sort: urutan asli dipertahankan untuk alignment sama
+        for (size_t i = 1; i < count; ++i) {
+            const size_t key = r.value[i];
+            size_t j = i;
+            while (j > 0 && aligns[r.value[j - 1]] < aligns[key]) {
+                r.value[j] = r.value[j - 1];
+                --j;
+            }
+            r.value[j] = key;
+        }
+        return r;
+    }();
+
+    /** @brief offsets.value[i] = byte offset dari member dengan index asli i */
+    static constexpr table offsets = [] {
+        constexpr size_t sizes[] = {sizeof(Ts)...};
+        table r{};
+        size_t off = 0;
+        for (size_t k = 0; k < count; ++k) {
+            r.value[order.value[k]] = off;
+            off += sizes[order.value[k]];
+        }
+        return r;
+    }();
+
+    static constexpr size_t size = align_up((0 + ... + sizeof(Ts)), align);
+};
+
+} // namespace detail
+
+/**
+ * @brief Tuple dengan layout packed (tanpa padding internal)
+ * @tparam Ts Tipe member (min 1, semua harus trivially copyable)
+ *
+ * Memory layout:
+ * - data_: sum(sizeof(Ts)...) dibulatkan ke max(alignof(Ts)...)
+ * - Member diurutkan alignment descending, get<I> memakai index asli
+ *
+ * @note Trivially copyable, sehingga dapat dipakai sebagai alternatif generic
+ *
+ * @example
+ * ```cpp
+ * packed_tuple<uint8_t, uint64_t, uint16_t> t(1, 2, 3);
+ * static_assert(sizeof(t) == 16);   // std::tuple / struct: 24
+ * uint64_t v = t.get<1>();          // index asli
+ * ```
+ */
+template <typename... Ts>
+requires (sizeof...(Ts) > 0)
+class packed_tuple {
+    static_assert((std::is_trivially_copyable_v<Ts> && ...),
+        "All types must be trivially copyable");
+
+public:
+    // ============= Type Aliases =============
+    using list_t = type_list_t<Ts...>;
+    using layout_t = detail::packed_layout<Ts...>;
+
+    template <size_t I>
+    using element_type = typename list_t::template type<I>;
+
+    static constexpr size_t element_count = sizeof...(Ts);
+    static constexpr size_t packed_size = layout_t::size;
+
+    /** @brief Offset byte member dengan index asli I */
+    template <size_t I>
+    requires (I < element_count)
+    static constexpr size_t offset_of = layout_t::offsets.value[I];
+
+private:
+    alignas(layout_t::align) uint8_t data_[packed_size]{};
+
+    template <size_t I>
+    [[nodiscard]] element_type<I>* ptr() noexcept {
+        return std::launder(reinterpret_cast<element_type<I>*>(data_ + offset_of<I>));
+    }
+
+    template <size_t I>
+    [[nodiscard]] const element_type<I>* ptr() const noexcept {
+        return std::launder(reinterpret_cast<const element_type<I>*>(data_ + offset_of<I>));
+    }
+
+    template <size_t... Is>
+    constexpr void store_all(const Ts&... values, std::index_sequence<Is...>) noexcept {
+        (std::memcpy(data_ + offset_of<Is>, &values, sizeof(Ts)), ...);
+    }
+
+public:
+    // ============= Constructors =============
+
+    /** @brief Default: semua byte nol */
+    constexpr packed_tuple() noexcept = default;
+    constexpr packed_tuple(const packed_tuple&) noexcept = default;
+    constexpr packed_tuple(packed_tuple&&) noexcept = default;
+    constexpr packed_tuple& operator=(const packed_tuple&) noexcept = default;
+    constexpr packed_tuple& operator=(packed_tuple&&) noexcept = default;
+
+    /** @brief Construct dari value per member (urutan asli) */
+    constexpr explicit packed_tuple(const Ts&... values) noexcept {
+        store_all(values..., std::index_sequence_for<Ts...>{});
+    }
+
+    // ============= Access =============
+
+    /** @brief Get member dengan index asli I */
+    template <size_t I>
+    requires (I < element_count)
+    [[nodiscard]] constexpr element_type<I>& get() noexcept { return *ptr<I>(); }
+
+    template <size_t I>
+    requires (I < element_count)
+    [[nodiscard]] constexpr const element_type<I>& get() const noexcept { return *ptr<I>(); }
+
+    /** @brief Get member berdasarkan tipe (tipe harus unik dalam Ts...) */
+    template <typename T>
+    requires (list_t::template contains<T>)
+    [[nodiscard]] constexpr T& get() noexcept {
+        return get<list_t::template index_of<T>>();
+    }
+
+    template <typename T>
+    requires (list_t::template contains<T>)
+    [[nodiscard]] constexpr const T& get() const noexcept {
+        return get<list_t::template index_of<T>>();
+    }
+
+    /** @brief Set member dengan index asli I */
+    template <size_t I>
+    requires (I < element_count)
+    constexpr void set(const element_type<I>& value) noexcept {
+        std::memcpy(data_ + offset_of<I>, &value, sizeof(value));
+    }
+
+    // ============= Comparison =============
+
+    /** @brief Bytewise equality (padding ekor selalu nol) */
+    [[nodiscard]] constexpr bool operator==(const packed_tuple& o) const noexcept {
+        return std::memcmp(data_, o.data_, packed_size) == 0;
+    }
+
+    // ============= Raw Access =============
+
+    [[nodiscard]] constexpr const uint8_t* data() const noexcept { return data_; }
+    [[nodiscard]] constexpr uint8_t* data() noexcept { return data_; }
+    [[nodiscard]] static constexpr size_t size() noexcept { return packed_size; }
+};
+
+// ============= Helper Functions =============
+
+/** @brief Free function get (untuk structured bindings) */
+template <size_t I, typename... Ts>
+[[nodiscard]] constexpr auto& get(packed_tuple<Ts...>& t) noexcept {
+    return t.template get<I>();
+}
+
+template <size_t I, typename... Ts>
+[[nodiscard]] constexpr const auto& get(const packed_tuple<Ts...>& t) noexcept {
+    return t.template get<I>();
+}
+
+/** @brief Factory function */
+template <typename... Ts>
+[[nodiscard]] constexpr auto make_packed_tuple(const Ts&... values) noexcept {
+    return packed_tuple<Ts...>(values...);
+}
+
+} // namespace zuu
+
+// ============= Structured Binding Support =============
+
+template <typename... Ts>
+struct std::tuple_size<zuu::packed_tuple<Ts...>>
+    : std::integral_constant<size_t, sizeof...(Ts)> {};
+
+template <size_t I, typename... Ts>
+struct std::tuple_element<I, zuu::packed_tuple<Ts...>> {
+    using type = typename zuu::packed_tuple<Ts...>::template element_type<I>;
+};
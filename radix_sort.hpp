@@ -0,0 +1,366 @@
+#pragma once
+
+/**
+ * @file radix_sort.hpp
+ * @brief Radix sort hybrid MSD/LSD untuk bytes<N>, composer<T> dan angka
+ * @version 1.0.0
+ *
+ * Key dipandang sebagai deretan digit 8 bit, digit 0 paling tidak
+ * signifikan. MSD mempartisi dari digit teratas sampai bucket kecil
+ * (insertion sort) atau sisa digit <= 3 (LSD, semua histogram dalam satu
+ * pass). Digit yang sama untuk seluruh bucket dilewati tanpa scatter.
+ *
+ * Transformasi order-preserving:
+ * - Unsigned: apa adanya
+ * - Signed: flip sign bit
+ * - Float: negatif -> invert semua bit, positif -> flip sign bit
+ * - bytes<N>: lexicographic_order (byte 0 paling signifikan, sama dengan
+ *   operator<=> bawaan) atau numeric_order (little-endian, byte N-1 paling
+ *   signifikan, sama dengan bigint.hpp)
+ *
+ * @note Stabil. Butuh buffer tambahan n key (+ n payload)
+ * @note Float: -0.0 < +0.0, NaN negatif di awal dan NaN positif di akhir
+ *
+ * @example
+ * ```cpp
+ * std::vector<bytes<16>> keys = ...;
+ * radix_sort(std::span(keys));                        // == std::sort
+ * radix_sort<numeric_order>(std::span(keys));         // urutan bigint
+ * radix_sort(std::span(keys), std::span(row_ids), 8); // key + payload, 8 thread
+ *
+ * std::vector<composer<double>> prices = ...;
+ * radix_sort(std::span(prices));
+ * ```
+ */
+
+#include "bytes.hpp"
+#include "composer.hpp"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace zuu {
+
+// ============= Order-Preserving Transform =============
+
+/**
+ * @brief Unsigned dengan urutan sama dengan nilai x
+ * @note ordered_bits(a) < ordered_bits(b) <=> a < b (float: lihat @file)
+ */
+template <typename T>
+requires std::is_arithmetic_v<T> && (!std::is_same_v<T, bool>)
+[[nodiscard]] constexpr auto ordered_bits(T x) noexcept {
+    using U = std::conditional_t<sizeof(T) == 1, uint8_t,
+              std::conditional_t<sizeof(T) == 2, uint16_t,
+              std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>>;
+    static_assert(sizeof(T) == sizeof(U), "unsupported arithmetic width");
+    constexpr U sign = static_cast<U>(U{1} << (sizeof(U) * 8 - 1));
+    const U u = std::bit_cast<U>(x);
+    if constexpr (std::is_floating_point_v<T>) {
+        return static_cast<U>(u ^ ((u & sign) ? static_cast<U>(~U{0}) : sign));
+    } else if constexpr (std::is_signed_v<T>) {
+        return static_cast<U>(u ^ sign);
+    } else {
+        return u;
+    }
+}
+
+// ============= Radix Traits =============
+
+/**
+ * @brief Digit key untuk radix sort
+ *
+ * digits: jumlah digit 8 bit; digit(k, d): digit ke-d (0 = paling tidak
+ * signifikan). Spesialisasi baru cukup menyediakan keduanya.
+ */
+template <typename K, typename Order>
+struct radix_traits;
+
+template <size_t N>
+struct radix_traits<bytes<N>, lexicographic_order> {
+    static constexpr size_t digits = N;
+    [[nodiscard]] static uint8_t digit(const bytes<N>& k, size_t d) noexcept { return k.data()[N - 1 - d]; }
+};
+
+template <size_t N>
+struct radix_traits<bytes<N>, numeric_order> {
+    static constexpr size_t digits = N;
+    [[nodiscard]] static uint8_t digit(const bytes<N>& k, size_t d) noexcept { return k.data()[d]; }
+};
+
+/** @brief Angka: urutan nilai, Order diabaikan */
+template <typename T, typename Order>
+requires std::is_arithmetic_v<T> && (!std::is_same_v<T, bool>)
+struct radix_traits<T, Order> {
+    static constexpr size_t digits = sizeof(T);
+    [[nodiscard]] static uint8_t digit(T k, size_t d) noexcept {
+        return static_cast<uint8_t>(ordered_bits(k) >> (d * 8));
+    }
+};
+
+/** @brief composer<T>: urutan nilai T (bukan urutan raw byte) */
+template <typename T, typename Order>
+requires std::is_arithmetic_v<T> && (!std::is_same_v<T, bool>)
+struct radix_traits<composer<T>, Order> {
+    static constexpr size_t digits = sizeof(T);
+    [[nodiscard]] static uint8_t digit(const composer<T>& k, size_t d) noexcept {
+        return radix_traits<T, Order>::digit(k.value(), d);
+    }
+};
+
+template <typename K, typename Order>
+concept radix_sortable = requires(const K& k) {
+    { radix_traits<K, Order>::digits } -> std::convertible_to<size_t>;
+    { radix_traits<K, Order>::digit(k, size_t{}) } -> std::same_as<uint8_t>;
+};
+
+namespace detail::radix {
+
+inline constexpr size_t insertion_threshold = 48;
+inline constexpr size_t lsd_max_digits = 3;
+
+/** @brief Minimal key per thread sebelum pass paralel dipakai */
+inline constexpr size_t parallel_grain = size_t{1} << 16;
+
+/** @brief Payload kosong untuk sort key saja */
+struct no_payload {};
+
+/**
+ * @brief Pasangan array key + payload yang dipindahkan bersama
+ */
+template <typename K, typename P>
+struct cursor {
+    static constexpr bool has_payload = !std::is_same_v<P, no_payload>;
+
+    K* k;
+    P* p;
+
+    [[nodiscard]] cursor operator+(size_t i) const noexcept { return {k + i, has_payload ? p + i : p}; }
+
+    void put(size_t i, const cursor& src, size_t j) const noexcept {
+        k[i] = src.k[j];
+        if constexpr (has_payload) p[i] = src.p[j];
+    }
+
+    void copy_to(const cursor& dst, size_t n) const noexcept {
+        std::copy(k, k + n, dst.k);
+        if constexpr (has_payload) std::copy(p, p + n, dst.p);
+    }
+};
+
+template <typename Tr, typename K>
+[[nodiscard]] bool less(const K& a, const K& b, size_t top) noexcept {
+    for (size_t d = top + 1; d-- > 0;) {
+        const uint8_t x = Tr::digit(a, d), y = Tr::digit(b, d);
+        if (x != y) return x < y;
+    }
+    return false;
+}
+
+/** @brief Stabil; hanya digit [0, top] yang dibandingkan */
+template <typename Tr, typename K, typename P>
+void insertion_sort(cursor<K, P> a, size_t n, size_t top) noexcept {
+    for (size_t i = 1; i < n; ++i) {
+        if (!less<Tr>(a.k[i], a.k[i - 1], top)) continue;
+        const K key = a.k[i];
+        [[maybe_unused]] P pay{};
+        if constexpr (cursor<K, P>::has_payload) pay = a.p[i];
+        size_t j = i;
+        for (; j > 0 && less<Tr>(key, a.k[j - 1], top); --j) a.put(j, a, j - 1);
+        a.k[j] = key;
+        if constexpr (cursor<K, P>::has_payload) a.p[j] = pay;
+    }
+}
+
+/** @brief Prefix sum eksklusif count[] -> offset[] */
+inline void offsets(const size_t* count, size_t* off) noexcept {
+    size_t sum = 0;
+    for (size_t i = 0; i < 256; ++i) {
+        off[i] = sum;
+        sum += count[i];
+    }
+}
+
+/**
+ * @brief LSD untuk digit [0, nd): data di a, b = scratch
+ * @param result_in_a true jika hasil harus berada di a
+ */
+template <typename Tr, typename K, typename P>
+void lsd(cursor<K, P> a, cursor<K, P> b, size_t n, size_t nd, bool result_in_a) noexcept {
+    size_t count[lsd_max_digits][256] = {};
+    for (size_t i = 0; i < n; ++i) {
+        for (size_t d = 0; d < nd; ++d) ++count[d][Tr::digit(a.k[i], d)];
+    }
+    bool in_a = true;
+    for (size_t d = 0; d < nd; ++d) {
+        if (count[d][Tr::digit(a.k[0], d)] == n) continue;   // digit sama semua
+        size_t off[256];
+        offsets(count[d], off);
+        for (size_t i = 0; i < n; ++i) b.put(off[Tr::digit(a.k[i], d)]++, a, i);
+        std::swap(a, b);
+        in_a = !in_a;
+    }
+    if (in_a != result_in_a) a.copy_to(b, n);
+}
+
+/**
+ * @brief MSD dari digit top: data di a, b = scratch (ping-pong tanpa copy-back)
+ */
+template <typename Tr, typename K, typename P>
+void msd(cursor<K, P> a, cursor<K, P> b, size_t n, size_t top, bool result_in_a) noexcept {
+    while (true) {
+        if (n <= insertion_threshold) {
+            insertion_sort<Tr>(a, n, top);
+            if (!result_in_a) a.copy_to(b, n);
+            return;
+        }
+        if (top < lsd_max_digits) {
+            lsd<Tr>(a, b, n, top + 1, result_in_a);
+            return;
+        }
+        size_t count[256] = {};
+        for (size_t i = 0; i < n; ++i) ++count[Tr::digit(a.k[i], top)];
+        if (count[Tr::digit(a.k[0], top)] == n) {
+            --top;
+            continue;
+        }
+        size_t off[256];
+        offsets(count, off);
+        for (size_t i = 0; i < n; ++i) b.put(off[Tr::digit(a.k[i], top)]++, a, i);
+        for (size_t c = 0, start = 0; c < 256; start += count[c++]) {
+            if (count[c]) msd<Tr>(b + start, a + start, count[c], top - 1, !result_in_a);
+        }
+        return;
+    }
+}
+
+template <typename Tr, typename K, typename P>
+void sort_sequential(cursor<K, P> a, cursor<K, P> scratch, size_t n) noexcept {
+    if (n > 1) msd<Tr>(a, scratch, n, Tr::digits - 1, true);
+}
+
+template <typename F>
+void run_threads(unsigned t, F&& f) {
+    std::vector<std::thread> pool;
+    pool.reserve(t - 1);
+    for (unsigned i = 1; i < t; ++i) pool.emplace_back(f, i);
+    f(0u);
+    for (auto& th : pool) th.join();
+}
+
+/**
+ * @brief Partisi paralel pada digit teratas, lalu bucket diurutkan paralel
+ *
+ * Setiap thread membuat histogram chunk-nya, offset dihitung per
+ * (bucket, thread) agar scatter stabil tanpa sinkronisasi. Bucket dibagi
+ * dinamis (terbesar dulu) ke thread.
+ */
+template <typename Tr, typename K, typename P>
+void sort_parallel(cursor<K, P> a, cursor<K, P> b, size_t n, unsigned t) {
+    std::vector<size_t> count(static_cast<size_t>(t) * 256);
+    const size_t chunk = (n + t - 1) / t;
+    const auto lo = [&](unsigned i) { return std::min(n, chunk * i); };
+
+    size_t top = Tr::digits - 1;
+    size_t total[256];
+    while (true) {
+        run_threads(t, [&](unsigned i) {
+            size_t* c = count.data() + static_cast<size_t>(i) * 256;
+            std::fill(c, c + 256, size_t{0});
+            for (size_t j = lo(i); j < lo(i + 1); ++j) ++c[Tr::digit(a.k[j], top)];
+        });
+        std::fill(total, total + 256, size_t{0});
+        for (unsigned i = 0; i < t; ++i) {
+            for (size_t c = 0; c < 256; ++c) total[c] += count[i * 256 + c];
+        }
+        if (total[Tr::digit(a.k[0], top)] != n || top == 0) break;
+        --top;
+    }
+
+    // offset[i][c] = awal bucket c + key bucket c dari thread < i
+    std::vector<size_t> off(count.size());
+    size_t bucket_start[257];
+    for (size_t c = 0, sum = 0; c < 256; ++c) {
+        bucket_start[c] = sum;
+        for (unsigned i = 0; i < t; ++i) {
+            off[i * 256 + c] = sum;
+            sum += count[i * 256 + c];
+        }
+    }
+    bucket_start[256] = n;
+
+    run_threads(t, [&](unsigned i) {
+        size_t* o = off.data() + static_cast<size_t>(i) * 256;
+        for (size_t j = lo(i); j < lo(i + 1); ++j) b.put(o[Tr::digit(a.k[j], top)]++, a, j);
+    });
+
+    uint8_t order[256];
+    size_t used = 0;
+    for (size_t c = 0; c < 256; ++c) {
+        if (total[c]) order[used++] = static_cast<uint8_t>(c);
+    }
+    std::sort(order, order + used, [&](uint8_t x, uint8_t y) { return total[x] > total[y]; });
+
+    std::atomic<size_t> next{0};
+    run_threads(t, [&](unsigned) {
+        for (size_t i; (i = next.fetch_add(1, std::memory_order_relaxed)) < used;) {
+            const size_t c = order[i];
+            const size_t s = bucket_start[c];
+            if (top == 0) (b + s).copy_to(a + s, total[c]);
+            else msd<Tr>(b + s, a + s, total[c], top - 1, false);
+        }
+    });
+}
+
+template <typename Tr, typename K, typename P>
+void sort(K* keys, P* payload, size_t n, unsigned threads) {
+    if (n < 2) return;
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    threads = static_cast<unsigned>(std::min<size_t>(threads, std::max<size_t>(1, n / parallel_grain)));
+
+    std::vector<K> sk(n);
+    std::vector<P> sp(cursor<K, P>::has_payload ? n : 0);
+    const cursor<K, P> a{keys, payload};
+    const cursor<K, P> b{sk.data(), sp.data()};
+    if (threads <= 1) sort_sequential<Tr>(a, b, n);
+    else sort_parallel<Tr>(a, b, n, threads);
+}
+
+} // namespace detail::radix
+
+// ============= Radix Sort =============
+
+/**
+ * @brief Urutkan keys (stabil)
+ * @tparam Order lexicographic_order atau numeric_order (untuk bytes<N>)
+ * @param threads 1 = sequential, 0 = std::thread::hardware_concurrency()
+ */
+template <typename Order = lexicographic_order, typename K>
+requires radix_sortable<K, Order>
+void radix_sort(std::span<K> keys, unsigned threads = 1) {
+    detail::radix::sort<radix_traits<K, Order>>(keys.data(), static_cast<detail::radix::no_payload*>(nullptr),
+                                                keys.size(), threads);
+}
+
+/**
+ * @brief Urutkan keys (stabil) dan terapkan permutasi yang sama ke payload
+ * @throws std::invalid_argument jika ukuran keys dan payload berbeda
+ */
+template <typename Order = lexicographic_order, typename K, typename P>
+requires radix_sortable<K, Order> && std::is_trivially_copyable_v<P> && std::is_default_constructible_v<P>
+void radix_sort(std::span<K> keys, std::span<P> payload, unsigned threads = 1) {
+    if (keys.size() != payload.size()) {
+        throw std::invalid_argument("radix_sort: keys and payload size differ");
+    }
+    detail::radix::sort<radix_traits<K, Order>>(keys.data(), payload.data(), keys.size(), threads);
+}
+
+} // namespace zuu
@@ -0,0 +1,554 @@
+#pragma once
+
+/**
+ * @file reed_solomon.hpp
+ * @brief Erasure coding Reed-Solomon sistematik k+m di atas GF(2^8)
+ * @version 1.0.0
+ *
+ * k shard data + m shard parity berukuran sama; shard mana pun (hingga m)
+ * yang hilang dapat direkonstruksi dari k shard tersisa. Matriks encode =
+ * [I_k; C] dengan C matriks Cauchy m x k, sehingga setiap submatriks k x k
+ * invertible dan shard data tersimpan apa adanya.
+ *
+ * Menyediakan:
+ * - gf256_mul / gf256_inv dan gf256_mul_add (dst ^= c * src) untuk buffer
+ * - reed_solomon: encode, reconstruct (shard yang hilang ditulis ulang),
+ *   verify
+ * - Kernel dot-product GF(2^8) dengan runtime dispatch: GFNI
+ *   (gf2p8affineqb, AVX-512/AVX2), pshufb nibble-table (AVX-512BW, AVX2,
+ *   SSSE3), dan tabel 256 byte sebagai fallback scalar. Hingga 4 shard
+ *   keluaran dihitung per pass atas shard masukan, per blok yang muat L2.
+ *
+ * @note Polinomial 0x11D (x^8 + x^4 + x^3 + x^2 + 1), generator 2
+ * @note Error: std::invalid_argument("reed_solomon: ...") untuk jumlah
+ *       shard, ukuran shard, atau indeks erasure yang salah
+ *
+ * @example
+ * ```cpp
+ * reed_solomon rs(10, 4);                       // 10 data + 4 parity
+ * std::vector<bytes_view> data = ...;           // 10 buffer sama panjang
+ * std::vector<mutable_bytes_view> parity = ...; // 4 buffer tujuan
+ * rs.encode(data, parity);
+ *
+ * // shard 2 dan 11 hilang: buffer-nya ditulis ulang
+ * std::vector<mutable_bytes_view> shards = ...; // 14 buffer
+ * const size_t lost[] = {2, 11};
+ * rs.reconstruct(shards, lost);
+ * ```
+ */
+
+#include "byte_buffer.hpp"
+#include "simd.hpp"
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace zuu {
+
+namespace detail::gf {
+
+inline constexpr unsigned poly = 0x11D;
+
+/** @brief Tabel exp (diperpanjang 510 agar exp[log a + log b] tanpa mod) dan log */
+struct log_tables {
+    uint8_t exp[512]{};
+    uint8_t log[256]{};
+};
+
+[[nodiscard]] constexpr log_tables make_log_tables() noexcept {
+    log_tables t;
+    unsigned x = 1;
+    for (unsigned i = 0; i < 255; ++i) {
+        t.exp[i] = static_cast<uint8_t>(x);
+        t.log[x] = static_cast<uint8_t>(i);
+        x <<= 1;
+        if (x & 0x100) x ^= poly;
+    }
+    for (unsigned i = 255; i < 512; ++i) t.exp[i] = t.exp[i - 255];
+    return t;
+}
+
+inline constexpr log_tables tables = make_log_tables();
+
+[[nodiscard]] constexpr uint8_t mul(uint8_t a, uint8_t b) noexcept {
+    if (a == 0 || b == 0) return 0;
+    return tables.exp[tables.log[a] + tables.log[b]];
+}
+
+/** @brief Invers perkalian; inv(0) = 0 */
+[[nodiscard]] constexpr uint8_t inv(uint8_t a) noexcept {
+    return a == 0 ? 0 : tables.exp[255 - tables.log[a]];
+}
+
+/**
+ * @brief Koefisien yang sudah disiapkan untuk kernel
+ *
+ * lo/hi: c * x untuk nibble rendah / tinggi (pshufb); affine: matriks bit
+ * 8x8 untuk gf2p8affineqb (byte 7 - i = baris penghasil bit keluaran i).
+ */
+struct coef {
+    alignas(16) uint8_t lo[16];
+    uint8_t hi[16];
+    uint64_t affine;
+    uint8_t c;
+};
+
+[[nodiscard]] constexpr coef make_coef(uint8_t c) noexcept {
+    coef r{};
+    r.c = c;
+    for (unsigned x = 0; x < 16; ++x) {
+        r.lo[x] = mul(c, static_cast<uint8_t>(x));
+        r.hi[x] = mul(c, static_cast<uint8_t>(x << 4));
+    }
+    for (unsigned i = 0; i < 8; ++i) {
+        uint64_t row = 0;
+        for (unsigned j = 0; j < 8; ++j) row |= static_cast<uint64_t>((mul(c, static_cast<uint8_t>(1u << j)) >> i) & 1) << j;
+        r.affine |= row << (8 * (7 - i));
+    }
+    return r;
+}
+
+// ============= Dot-product Kernels =============
+
+/**
+ * @brief dst[r][off..off+n) (^)= sum_j coefs[r*k + j] * src[j][off..off+n), r < g
+ * @param accumulate true: XOR ke isi dst; false: timpa dst
+ */
+using dot_fn = void (*)(const uint8_t* const* src, size_t k, uint8_t* const* dst, size_t g, const coef* coefs,
+                        size_t off, size_t n, bool accumulate) noexcept;
+
+/** @brief Byte [i, n) per byte (tail kernel vektor) */
+inline void dot_tail(const uint8_t* const* src, size_t k, uint8_t* const* dst, size_t g, const coef* coefs,
+                     size_t off, size_t i, size_t n, bool accumulate) noexcept {
+    for (size_t r = 0; r < g; ++r) {
+        for (size_t b = i; b < n; ++b) {
+            uint8_t acc = accumulate ? dst[r][off + b] : 0;
+            for (size_t j = 0; j < k; ++j) acc ^= mul(coefs[r * k + j].c, src[j][off + b]);
+            dst[r][off + b] = acc;
+        }
+    }
+}
+
+/** @brief Scalar: tabel 256 byte per koefisien, satu baris keluaran per pass */
+inline void dot_scalar(const uint8_t* const* src, size_t k, uint8_t* const* dst, size_t g, const coef* coefs,
+                       size_t off, size_t n, bool accumulate) noexcept {
+    uint8_t row[256];
+    for (size_t r = 0; r < g; ++r) {
+        uint8_t* d = dst[r] + off;
+        if (!accumulate) std::memset(d, 0, n);
+        for (size_t j = 0; j < k; ++j) {
+            const coef& c = coefs[r * k + j];
+            for (unsigned x = 0; x < 256; ++x) row[x] = static_cast<uint8_t>(c.lo[x & 15] ^ c.hi[x >> 4]);
+            const uint8_t* s = src[j] + off;
+            for (size_t b = 0; b < n; ++b) d[b] ^= row[s[b]];
+        }
+    }
+}
+
+#ifdef ZUU_SIMD_X86
+
+/**
+ * @brief G baris keluaran per pass: setiap vektor src dimuat sekali lalu
+ *        dikalikan ke G akumulator (lo/hi nibble via pshufb)
+ */
+template <size_t G>
+ZUU_TARGET("ssse3")
+inline void dot_ssse3_g(const uint8_t* const* src, size_t k, uint8_t* const* dst, const coef* coefs,
+                        size_t off, size_t n, bool accumulate) noexcept {
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i acc[G];
+        for (size_t r = 0; r < G; ++r)
+            acc[r] = accumulate ? _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst[r] + off + i)) : _mm_setzero_si128();
+        for (size_t j = 0; j < k; ++j) {
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src[j] + off + i));
+            const __m128i lo = _mm_and_si128(v, mask), hi = _mm_and_si128(_mm_srli_epi64(v, 4), mask);
+            for (size_t r = 0; r < G; ++r) {
+                const coef& c = coefs[r * k + j];
+                acc[r] = _mm_xor_si128(acc[r], _mm_xor_si128(
+                    _mm_shuffle_epi8(_mm_load_si128(reinterpret_cast<const __m128i*>(c.lo)), lo),
+                    _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(c.hi)), hi)));
+            }
+        }
+        for (size_t r = 0; r < G; ++r) _mm_storeu_si128(reinterpret_cast<__m128i*>(dst[r] + off + i), acc[r]);
+    }
+    dot_tail(src, k, dst, G, coefs, off, i, n, accumulate);
+}
+
+template <size_t G>
+ZUU_TARGET("avx2")
+inline void dot_avx2_g(const uint8_t* const* src, size_t k, uint8_t* const* dst, const coef* coefs,
+                       size_t off, size_t n, bool accumulate) noexcept {
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i acc[G];
+        for (size_t r = 0; r < G; ++r)
+            acc[r] = accumulate ? _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst[r] + off + i)) : _mm256_setzero_si256();
+        for (size_t j = 0; j < k; ++j) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src[j] + off + i));
+            const __m256i lo = _mm256_and_si256(v, mask), hi = _mm256_and_si256(_mm256_srli_epi64(v, 4), mask);
+            for (size_t r = 0; r < G; ++r) {
+                const coef& c = coefs[r * k + j];
+                const __m256i tlo = _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i*>(c.lo)));
+                const __m256i thi = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(c.hi)));
+                acc[r] = _mm256_xor_si256(acc[r], _mm256_xor_si256(_mm256_shuffle_epi8(tlo, lo), _mm256_shuffle_epi8(thi, hi)));
+            }
+        }
+        for (size_t r = 0; r < G; ++r) _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst[r] + off + i), acc[r]);
+    }
+    dot_tail(src, k, dst, G, coefs, off, i, n, accumulate);
+}
+
+template <size_t G>
+ZUU_TARGET("avx512f,avx512bw")
+inline void dot_avx512_g(const uint8_t* const* src, size_t k, uint8_t* const* dst, const coef* coefs,
+                         size_t off, size_t n, bool accumulate) noexcept {
+    const __m512i mask = _mm512_set1_epi8(0x0F);
+    const __mmask16 all = 0xFFFF;
+    size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        __m512i acc[G];
+        for (size_t r = 0; r < G; ++r) acc[r] = accumulate ? _mm512_loadu_si512(dst[r] + off + i) : _mm512_setzero_si512();
+        for (size_t j = 0; j < k; ++j) {
+            const __m512i v = _mm512_loadu_si512(src[j] + off + i);
+            const __m512i lo = _mm512_and_si512(v, mask), hi = _mm512_and_si512(_mm512_srli_epi16(v, 4), mask);
+            for (size_t r = 0; r < G; ++r) {
+                const coef& c = coefs[r * k + j];
+                // maskz: varian tanpa mask memakai _mm512_undefined (GCC -Wmaybe-uninitialized)
+                const __m512i tlo = _mm512_maskz_broadcast_i32x4(all, _mm_load_si128(reinterpret_cast<const __m128i*>(c.lo)));
+                const __m512i thi = _mm512_maskz_broadcast_i32x4(all, _mm_loadu_si128(reinterpret_cast<const __m128i*>(c.hi)));
+                acc[r] = _mm512_xor_si512(acc[r], _mm512_xor_si512(_mm512_shuffle_epi8(tlo, lo), _mm512_shuffle_epi8(thi, hi)));
+            }
+        }
+        for (size_t r = 0; r < G; ++r) _mm512_storeu_si512(dst[r] + off + i, acc[r]);
+    }
+    dot_tail(src, k, dst, G, coefs, off, i, n, accumulate);
+}
+
+/** @brief GFNI: satu gf2p8affineqb per (shard, koefisien) */
+template <size_t G>
+ZUU_TARGET("gfni,avx2")
+inline void dot_gfni_avx2_g(const uint8_t* const* src, size_t k, uint8_t* const* dst, const coef* coefs,
+                            size_t off, size_t n, bool accumulate) noexcept {
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i acc[G];
+        for (size_t r = 0; r < G; ++r)
+            acc[r] = accumulate ? _mm256_loadu_si256(reinterpret_cast<const __m256i*>(dst[r] + off + i)) : _mm256_setzero_si256();
+        for (size_t j = 0; j < k; ++j) {
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src[j] + off + i));
+            for (size_t r = 0; r < G; ++r) {
+                const __m256i a = _mm256_set1_epi64x(static_cast<long long>(coefs[r * k + j].affine));
+                acc[r] = _mm256_xor_si256(acc[r], _mm256_gf2p8affine_epi64_epi8(v, a, 0));
+            }
+        }
+        for (size_t r = 0; r < G; ++r) _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst[r] + off + i), acc[r]);
+    }
+    dot_tail(src, k, dst, G, coefs, off, i, n, accumulate);
+}
+
+template <size_t G>
+ZUU_TARGET("gfni,avx512f,avx512bw")
+inline void dot_gfni_avx512_g(const uint8_t* const* src, size_t k, uint8_t* const* dst, const coef* coefs,
+                              size_t off, size_t n, bool accumulate) noexcept {
+    size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        __m512i acc[G];
+        for (size_t r = 0; r < G; ++r) acc[r] = accumulate ? _mm512_loadu_si512(dst[r] + off + i) : _mm512_setzero_si512();
+        for (size_t j = 0; j < k; ++j) {
+            const __m512i v = _mm512_loadu_si512(src[j] + off + i);
+            for (size_t r = 0; r < G; ++r) {
+                const __m512i a = _mm512_set1_epi64(static_cast<long long>(coefs[r * k + j].affine));
+                acc[r] = _mm512_xor_si512(acc[r], _mm512_gf2p8affine_epi64_epi8(v, a, 0));
+            }
+        }
+        for (size_t r = 0; r < G; ++r) _mm512_storeu_si512(dst[r] + off + i, acc[r]);
+    }
+    dot_tail(src, k, dst, G, coefs, off, i, n, accumulate);
+}
+
+/** @brief Kernel dengan jumlah baris keluaran tetap G */
+using dot_g_fn = void (*)(const uint8_t* const* src, size_t k, uint8_t* const* dst, const coef* coefs,
+                          size_t off, size_t n, bool accumulate) noexcept;
+
+/** @brief Pecah g baris menjadi grup 4 (akumulator tetap di register) */
+template <dot_g_fn G1, dot_g_fn G2, dot_g_fn G3, dot_g_fn G4>
+inline void dot_groups(const uint8_t* const* src, size_t k, uint8_t* const* dst, size_t g, const coef* coefs,
+                       size_t off, size_t n, bool accumulate) noexcept {
+    for (; g >= 4; g -= 4, dst += 4, coefs += 4 * k) G4(src, k, dst, coefs, off, n, accumulate);
+    if (g == 3) G3(src, k, dst, coefs, off, n, accumulate);
+    else if (g == 2) G2(src, k, dst, coefs, off, n, accumulate);
+    else if (g == 1) G1(src, k, dst, coefs, off, n, accumulate);
+}
+
+inline constexpr dot_fn dot_ssse3 =
+    &dot_groups<&dot_ssse3_g<1>, &dot_ssse3_g<2>, &dot_ssse3_g<3>, &dot_ssse3_g<4>>;
+inline constexpr dot_fn dot_avx2 =
+    &dot_groups<&dot_avx2_g<1>, &dot_avx2_g<2>, &dot_avx2_g<3>, &dot_avx2_g<4>>;
+inline constexpr dot_fn dot_avx512 =
+    &dot_groups<&dot_avx512_g<1>, &dot_avx512_g<2>, &dot_avx512_g<3>, &dot_avx512_g<4>>;
+inline constexpr dot_fn dot_gfni_avx2 =
+    &dot_groups<&dot_gfni_avx2_g<1>, &dot_gfni_avx2_g<2>, &dot_gfni_avx2_g<3>, &dot_gfni_avx2_g<4>>;
+inline constexpr dot_fn dot_gfni_avx512 =
+    &dot_groups<&dot_gfni_avx512_g<1>, &dot_gfni_avx512_g<2>, &dot_gfni_avx512_g<3>, &dot_gfni_avx512_g<4>>;
+
+#endif // ZUU_SIMD_X86
+
+[[nodiscard]] inline dot_fn select_dot() noexcept {
+#ifdef ZUU_SIMD_X86
+    const auto& f = simd::cpu();
+    if (f.gfni && f.avx512bw) return dot_gfni_avx512;
+    if (f.avx512bw) return dot_avx512;
+    if (f.gfni && f.avx2) return dot_gfni_avx2;
+    if (f.avx2) return dot_avx2;
+    if (f.ssse3) return dot_ssse3;
+#endif
+    return &dot_scalar;
+}
+
+inline void dot(const uint8_t* const* src, size_t k, uint8_t* const* dst, size_t g, const coef* coefs,
+                size_t off, size_t n, bool accumulate) noexcept {
+    static const dot_fn fn = select_dot();
+    fn(src, k, dst, g, coefs, off, n, accumulate);
+}
+
+/** @brief Byte per blok: k shard masukan + keluaran tetap di L2 */
+inline constexpr size_t block_bytes = 16 * 1024;
+
+/** @brief dot() per blok block_bytes (satu pass atas src untuk setiap 4 baris) */
+inline void dot_blocked(const uint8_t* const* src, size_t k, uint8_t* const* dst, size_t g, const coef* coefs,
+                        size_t n) noexcept {
+    for (size_t off = 0; off < n; off += block_bytes) {
+        const size_t len = n - off < block_bytes ? n - off : block_bytes;
+        dot(src, k, dst, g, coefs, off, len, false);
+    }
+}
+
+/**
+ * @brief Invers matriks k x k (row-major) dengan eliminasi Gauss-Jordan
+ * @return false jika singular
+ */
+[[nodiscard]] inline bool invert(std::vector<uint8_t> a, std::vector<uint8_t>& out, size_t k) {
+    out.assign(k * k, 0);
+    for (size_t i = 0; i < k; ++i) out[i * k + i] = 1;
+    for (size_t col = 0; col < k; ++col) {
+        size_t pivot = col;
+        while (pivot < k && a[pivot * k + col] == 0) ++pivot;
+        if (pivot == k) return false;
+        if (pivot != col) {
+            for (size_t j = 0; j < k; ++j) {
+                std::swap(a[pivot * k + j], a[col * k + j]);
+                std::swap(out[pivot * k + j], out[col * k + j]);
+            }
+        }
+        const uint8_t s = inv(a[col * k + col]);
+        for (size_t j = 0; j < k; ++j) {
+            a[col * k + j] = mul(a[col * k + j], s);
+            out[col * k + j] = mul(out[col * k + j], s);
+        }
+        for (size_t row = 0; row < k; ++row) {
+            const uint8_t f = a[row * k + col];
+            if (row == col || f == 0) continue;
+            for (size_t j = 0; j < k; ++j) {
+                a[row * k + j] ^= mul(f, a[col * k + j]);
+                out[row * k + j] ^= mul(f, out[col * k + j]);
+            }
+        }
+    }
+    return true;
+}
+
+} // namespace detail::gf
+
+// ============= GF(2^8) =============
+
+[[nodiscard]] constexpr uint8_t gf256_mul(uint8_t a, uint8_t b) noexcept { return detail::gf::mul(a, b); }
+
+/** @brief Invers perkalian di GF(2^8); gf256_inv(0) = 0 */
+[[nodiscard]] constexpr uint8_t gf256_inv(uint8_t a) noexcept { return detail::gf::inv(a); }
+
+/**
+ * @brief dst ^= c * src per byte (min(dst.size(), src.size()) byte)
+ * @note Memakai kernel SIMD yang sama dengan reed_solomon
+ */
+inline void gf256_mul_add(mutable_bytes_view dst, bytes_view src, uint8_t c) noexcept {
+    const size_t n = dst.size() < src.size() ? dst.size() : src.size();
+    if (n == 0 || c == 0) return;
+    const detail::gf::coef k = detail::gf::make_coef(c);
+    const uint8_t* s = src.data();
+    uint8_t* d = dst.data();
+    detail::gf::dot(&s, 1, &d, 1, &k, 0, n, true);
+}
+
+// ============= Reed-Solomon =============
+
+/**
+ * @brief Codec Reed-Solomon sistematik dengan k shard data dan m shard parity
+ *
+ * Semua shard dalam satu panggilan harus berukuran sama (ukuran bebas).
+ * Objek immutable setelah dibangun: aman dipakai bersamaan dari banyak thread.
+ */
+class reed_solomon {
+public:
+    /** @brief Batas k + m (titik Cauchy harus berbeda di GF(2^8)) */
+    static constexpr size_t max_shards = 256;
+
+private:
+    size_t k_;
+    size_t m_;
+    std::vector<uint8_t> matrix_;               ///< (k + m) x k, baris 0..k-1 = identitas
+    std::vector<detail::gf::coef> parity_;      ///< Baris parity (m x k) siap kernel
+
+    [[nodiscard]] static size_t shard_size(auto shards) {
+        const size_t n = shards.empty() ? 0 : shards[0].size();
+        for (const auto& s : shards)
+            if (s.size() != n) throw std::invalid_argument("reed_solomon: shards must have equal size");
+        return n;
+    }
+
+    [[nodiscard]] static std::vector<detail::gf::coef> prepare(const uint8_t* rows, size_t count) {
+        std::vector<detail::gf::coef> r(count);
+        for (size_t i = 0; i < count; ++i) r[i] = detail::gf::make_coef(rows[i]);
+        return r;
+    }
+
+public:
+    // ============= Constructors =============
+
+    /**
+     * @throws std::invalid_argument jika k == 0, m == 0, atau k + m > max_shards
+     */
+    reed_solomon(size_t data_shards, size_t parity_shards) : k_(data_shards), m_(parity_shards) {
+        if (k_ == 0 || m_ == 0 || k_ + m_ > max_shards)
+            throw std::invalid_argument("reed_solomon: need 1 <= k, 1 <= m, k + m <= 256");
+        matrix_.assign((k_ + m_) * k_, 0);
+        for (size_t i = 0; i < k_; ++i) matrix_[i * k_ + i] = 1;
+        // Cauchy: C[i][j] = 1 / (x_i + y_j), x_i = k + i, y_j = j (semua berbeda)
+        for (size_t i = 0; i < m_; ++i)
+            for (size_t j = 0; j < k_; ++j)
+                matrix_[(k_ + i) * k_ + j] = detail::gf::inv(static_cast<uint8_t>((k_ + i) ^ j));
+        parity_ = prepare(matrix_.data() + k_ * k_, m_ * k_);
+    }
+
+    // ============= Observers =============
+
+    [[nodiscard]] size_t data_shards() const noexcept { return k_; }
+    [[nodiscard]] size_t parity_shards() const noexcept { return m_; }
+    [[nodiscard]] size_t total_shards() const noexcept { return k_ + m_; }
+
+    /** @brief Koefisien matriks encode: shard row = sum_j coefficient(row, j) * data[j] */
+    [[nodiscard]] uint8_t coefficient(size_t row, size_t col) const noexcept { return matrix_[row * k_ + col]; }
+
+    // ============= Encode =============
+
+    /**
+     * @brief Hitung m shard parity dari k shard data
+     * @throws std::invalid_argument jika jumlah atau ukuran shard salah
+     */
+    void encode(std::span<const bytes_view> data, std::span<const mutable_bytes_view> parity) const {
+        if (data.size() != k_ || parity.size() != m_) throw std::invalid_argument("reed_solomon: wrong shard count");
+        const size_t n = shard_size(data);
+        if (shard_size(parity) != n) throw std::invalid_argument("reed_solomon: shards must have equal size");
+
+        std::vector<const uint8_t*> src(k_);
+        std::vector<uint8_t*> dst(m_);
+        for (size_t j = 0; j < k_; ++j) src[j] = data[j].data();
+        for (size_t i = 0; i < m_; ++i) dst[i] = parity[i].data();
+        detail::gf::dot_blocked(src.data(), k_, dst.data(), m_, parity_.data(), n);
+    }
+
+    /** @brief True jika shard parity konsisten dengan shard data (k + m shard) */
+    [[nodiscard]] bool verify(std::span<const bytes_view> shards) const {
+        if (shards.size() != k_ + m_) throw std::invalid_argument("reed_solomon: wrong shard count");
+        const size_t n = shard_size(shards);
+
+        std::vector<const uint8_t*> src(k_);
+        for (size_t j = 0; j < k_; ++j) src[j] = shards[j].data();
+        byte_buffer scratch(m_ * detail::gf::block_bytes);
+        std::vector<uint8_t*> dst(m_);
+        for (size_t i = 0; i < m_; ++i) dst[i] = scratch.data() + i * detail::gf::block_bytes;
+
+        for (size_t off = 0; off < n; off += detail::gf::block_bytes) {
+            const size_t len = n - off < detail::gf::block_bytes ? n - off : detail::gf::block_bytes;
+            std::vector<const uint8_t*> at(k_);
+            for (size_t j = 0; j < k_; ++j) at[j] = src[j] + off;
+            detail::gf::dot(at.data(), k_, dst.data(), m_, parity_.data(), 0, len, false);
+            for (size_t i = 0; i < m_; ++i)
+                if (std::memcmp(dst[i], shards[k_ + i].data() + off, len) != 0) return false;
+        }
+        return true;
+    }
+
+    // ============= Reconstruct =============
+
+    /**
+     * @brief Tulis ulang shard yang hilang dari k shard yang tersisa
+     * @param shards k + m buffer sama panjang; isi buffer di erasures diabaikan
+     * @param erasures Indeks shard yang hilang (unik, paling banyak m)
+     * @throws std::invalid_argument jika indeks invalid atau erasure > m
+     */
+    void reconstruct(std::span<const mutable_bytes_view> shards, std::span<const size_t> erasures) const {
+        if (shards.size() != k_ + m_) throw std::invalid_argument("reed_solomon: wrong shard count");
+        if (erasures.size() > m_) throw std::invalid_argument("reed_solomon: too many erasures");
+        const size_t n = shard_size(shards);
+
+        std::vector<bool> lost(k_ + m_, false);
+        for (size_t e : erasures) {
+            if (e >= k_ + m_ || lost[e]) throw std::invalid_argument("reed_solomon: invalid erasure index");
+            lost[e] = true;
+        }
+
+        std::vector<uint8_t*> lost_data;
+        std::vector<size_t> lost_data_rows;
+        for (size_t j = 0; j < k_; ++j) {
+            if (lost[j]) {
+                lost_data.push_back(shards[j].data());
+                lost_data_rows.push_back(j);
+            }
+        }
+
+        if (!lost_data.empty()) {
+            // k shard pertama yang masih ada -> submatriks k x k -> invers
+            std::vector<const uint8_t*> src;
+            std::vector<uint8_t> sub;
+            sub.reserve(k_ * k_);
+            for (size_t row = 0; row < k_ + m_ && src.size() < k_; ++row) {
+                if (lost[row]) continue;
+                src.push_back(shards[row].data());
+                sub.insert(sub.end(), matrix_.begin() + static_cast<std::ptrdiff_t>(row * k_),
+                           matrix_.begin() + static_cast<std::ptrdiff_t>((row + 1) * k_));
+            }
+            std::vector<uint8_t> decode;
+            if (!detail::gf::invert(std::move(sub), decode, k_))
+                throw std::invalid_argument("reed_solomon: singular decode matrix");
+
+            std::vector<uint8_t> rows;
+            rows.reserve(lost_data_rows.size() * k_);
+            for (size_t j : lost_data_rows)
+                rows.insert(rows.end(), decode.begin() + static_cast<std::ptrdiff_t>(j * k_),
+                            decode.begin() + static_cast<std::ptrdiff_t>((j + 1) * k_));
+            const auto coefs = prepare(rows.data(), rows.size());
+            detail::gf::dot_blocked(src.data(), k_, lost_data.data(), lost_data.size(), coefs.data(), n);
+        }
+
+        // Parity yang hilang: encode ulang dari data (sudah lengkap)
+        std::vector<const uint8_t*> data(k_);
+        for (size_t j = 0; j < k_; ++j) data[j] = shards[j].data();
+        std::vector<uint8_t*> dst;
+        std::vector<detail::gf::coef> coefs;
+        for (size_t i = 0; i < m_; ++i) {
+            if (!lost[k_ + i]) continue;
+            dst.push_back(shards[k_ + i].data());
+            coefs.insert(coefs.end(), parity_.begin() + static_cast<std::ptrdiff_t>(i * k_),
+                         parity_.begin() + static_cast<std::ptrdiff_t>((i + 1) * k_));
+        }
+        if (!dst.empty()) detail::gf::dot_blocked(data.data(), k_, dst.data(), dst.size(), coefs.data(), n);
+    }
+};
+
+} // namespace zuu
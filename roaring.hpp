@@ -0,0 +1,973 @@
+#pragma once
+
+/**
+ * @file roaring.hpp
+ * @brief Compressed bitmap (Roaring) untuk himpunan integer 32-bit
+ * @version 1.0.0
+ *
+ * Nilai 32-bit dipecah: 16 bit atas memilih container, 16 bit bawah disimpan
+ * dalam container dengan salah satu dari tiga representasi:
+ * - array: uint16_t terurut (kardinalitas <= 4096)
+ * - bitmap: blok bytes<8192>, operasi memakai kernel simd.hpp
+ * - run: pasangan (start, length - 1) untuk rentang berurutan
+ *
+ * and_many / or_many menggabungkan banyak bitmap per container sekaligus
+ * (satu akumulator per key, tanpa bitmap hasil antara). Format serial dapat
+ * dibaca langsung tanpa deserialisasi (mis. dari mmap) lewat roaring_view.
+ *
+ * @example
+ * ```cpp
+ * roaring_bitmap a{1, 2, 3, 100000}, b;
+ * b.add_range(0, 1'000'000);
+ * auto hits = and_many({&a, &b, &c});     // tanpa a & b sementara
+ * byte_buffer file = hits.serialize();
+ * roaring_view v(bytes_view(mmap_ptr, mmap_len));
+ * bool found = v.contains(42);
+ * ```
+ */
+
+#include "byte_buffer.hpp"
+#include "bytes.hpp"
+#include "endian.hpp"
+#include "simd.hpp"
+#include <algorithm>
+#include <concepts>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <memory>
+#include <span>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace zuu {
+
+class roaring_bitmap;
+
+namespace detail::roaring {
+
+// ============= Container Primitives =============
+
+enum class container_kind : uint8_t { array = 1, bitmap = 2, run = 3 };
+
+/** @brief Blok bitmap dense: 65536 bit */
+using block = bytes<8192>;
+
+inline constexpr size_t block_bytes = block::byte_count;
+
+/** @brief Kardinalitas maksimum container array */
+inline constexpr uint32_t array_max = 4096;
+
+/**
+ * @brief Referensi read-only ke satu container (owning atau serial)
+ * @note data berisi nilai (array) atau pasangan (start, length - 1) (run)
+ */
+struct container_ref {
+    container_kind kind = container_kind::array;
+    uint32_t card = 0;
+    const uint16_t* data = nullptr;
+    uint32_t size = 0;              ///< Jumlah uint16_t pada data
+    const uint8_t* bits = nullptr;  ///< block_bytes byte untuk bitmap
+};
+
+[[nodiscard]] inline bool container_contains(const container_ref& c, uint16_t v) noexcept {
+    switch (c.kind) {
+    case container_kind::array:
+        return std::binary_search(c.data, c.data + c.size, v);
+    case container_kind::bitmap:
+        return ((c.bits[v / 8] >> (v % 8)) & 1u) != 0;
+    case container_kind::run: {
+        // Run terakhir dengan start <= v
+        uint32_t lo = 0, hi = c.size / 2;
+        while (lo < hi) {
+            const uint32_t mid = (lo + hi) / 2;
+            if (c.data[2 * mid] <= v) lo = mid + 1;
+            else hi = mid;
+        }
+        return lo > 0 && v <= uint32_t{c.data[2 * lo - 2]} + c.data[2 * lo - 1];
+    }
+    }
+    return false;
+}
+
+/**
+ * @brief Cek payload container dari sumber tak tepercaya (mis. file mmap)
+ *
+ * array: strictly increasing; bitmap: popcount == card; run: setiap
+ * start + (length - 1) <= 0xFFFF, urut dan tidak overlap, total = card.
+ */
+[[nodiscard]] inline bool payload_valid(const container_ref& c) noexcept {
+    switch (c.kind) {
+    case container_kind::array:
+        for (uint32_t i = 1; i < c.size; ++i)
+            if (c.data[i - 1] >= c.data[i]) return false;
+        return true;
+    case container_kind::bitmap:
+        return simd::popcount(c.bits, block_bytes) == c.card;
+    case container_kind::run: {
+        uint64_t total = 0;
+        int64_t prev_end = -1;
+        for (uint32_t i = 0; i < c.size; i += 2) {
+            const uint32_t start = c.data[i], end = start + c.data[i + 1];
+            if (end > 0xFFFF || int64_t{start} <= prev_end) return false;
+            prev_end = end;
+            total += end - start + 1;
+        }
+        return total == c.card;
+    }
+    }
+    return false;
+}
+
+/** @brief Set bit [lo, hi] (inklusif) dalam blok */
+inline void set_range(uint8_t* bits, uint32_t lo, uint32_t hi) noexcept {
+    const uint32_t lb = lo / 8, hb = hi / 8;
+    const auto low_mask = static_cast<uint8_t>(0xFFu << (lo % 8));
+    const auto high_mask = static_cast<uint8_t>(0xFFu >> (7 - hi % 8));
+    if (lb == hb) {
+        bits[lb] |= static_cast<uint8_t>(low_mask & high_mask);
+        return;
+    }
+    bits[lb] |= low_mask;
+    std::memset(bits + lb + 1, 0xFF, hb - lb - 1);
+    bits[hb] |= high_mask;
+}
+
+/** @brief Panggil f(low16) untuk setiap nilai, ascending */
+template <typename F>
+void for_each_value(const container_ref& c, F&& f) {
+    switch (c.kind) {
+    case container_kind::array:
+        for (uint32_t i = 0; i < c.size; ++i) f(c.data[i]);
+        break;
+    case container_kind::bitmap:
+        for (size_t p : bytes_view(c.bits, block_bytes).set_bits()) f(static_cast<uint16_t>(p));
+        break;
+    case container_kind::run:
+        for (uint32_t i = 0; i < c.size; i += 2) {
+            const uint32_t end = uint32_t{c.data[i]} + c.data[i + 1];
+            for (uint32_t v = c.data[i]; v <= end; ++v) f(static_cast<uint16_t>(v));
+        }
+        break;
+    }
+}
+
+/** @brief bits |= c */
+inline void or_into(uint8_t* bits, const container_ref& c) noexcept {
+    switch (c.kind) {
+    case container_kind::array:
+        for (uint32_t i = 0; i < c.size; ++i) bits[c.data[i] / 8] |= static_cast<uint8_t>(1u << (c.data[i] % 8));
+        break;
+    case container_kind::bitmap:
+        simd::bitwise<simd::bit_op::or_>(bits, bits, c.bits, block_bytes);
+        break;
+    case container_kind::run:
+        for (uint32_t i = 0; i < c.size; i += 2) set_range(bits, c.data[i], uint32_t{c.data[i]} + c.data[i + 1]);
+        break;
+    }
+}
+
+/** @brief bits &= c (array/run dimaterialisasi ke blok sementara) */
+inline void and_into(uint8_t* bits, const container_ref& c) {
+    if (c.kind == container_kind::bitmap) {
+        simd::bitwise<simd::bit_op::and_>(bits, bits, c.bits, block_bytes);
+        return;
+    }
+    const auto tmp = std::make_unique<block>();
+    or_into(tmp->data(), c);
+    simd::bitwise<simd::bit_op::and_>(bits, bits, tmp->data(), block_bytes);
+}
+
+/** @brief Pertahankan kandidat (terurut) yang ada di c; cursor maju monoton */
+inline void filter(std::vector<uint16_t>& cand, const container_ref& c) {
+    size_t out = 0;
+    switch (c.kind) {
+    case container_kind::array: {
+        const uint16_t* it = c.data;
+        const uint16_t* const end = c.data + c.size;
+        for (uint16_t v : cand) {
+            it = std::lower_bound(it, end, v);
+            if (it == end) break;
+            if (*it == v) cand[out++] = v;
+        }
+        break;
+    }
+    case container_kind::bitmap:
+        for (uint16_t v : cand) {
+            if ((c.bits[v / 8] >> (v % 8)) & 1u) cand[out++] = v;
+        }
+        break;
+    case container_kind::run: {
+        uint32_t r = 0;
+        for (uint16_t v : cand) {
+            while (r < c.size && uint32_t{c.data[r]} + c.data[r + 1] < v) r += 2;
+            if (r == c.size) break;
+            if (c.data[r] <= v) cand[out++] = v;
+        }
+        break;
+    }
+    }
+    cand.resize(out);
+}
+
+/** @brief Semua nilai container sebagai array terurut */
+[[nodiscard]] inline std::vector<uint16_t> values_of(const container_ref& c) {
+    std::vector<uint16_t> v;
+    v.reserve(c.card);
+    for_each_value(c, [&](uint16_t x) { v.push_back(x); });
+    return v;
+}
+
+/** @brief Representasi run dari container */
+[[nodiscard]] inline std::vector<uint16_t> runs_of(const container_ref& c) {
+    if (c.kind == container_kind::run) return {c.data, c.data + c.size};
+    std::vector<uint16_t> runs;
+    uint32_t start = 0, prev = 0;
+    bool open = false;
+    for_each_value(c, [&](uint16_t x) {
+        if (open && x == prev + 1) {
+            prev = x;
+            return;
+        }
+        if (open) {
+            runs.push_back(static_cast<uint16_t>(start));
+            runs.push_back(static_cast<uint16_t>(prev - start));
+        }
+        start = prev = x;
+        open = true;
+    });
+    if (open) {
+        runs.push_back(static_cast<uint16_t>(start));
+        runs.push_back(static_cast<uint16_t>(prev - start));
+    }
+    return runs;
+}
+
+[[nodiscard]] inline uint32_t run_cardinality(const std::vector<uint16_t>& runs) noexcept {
+    uint32_t card = 0;
+    for (size_t i = 0; i < runs.size(); i += 2) card += uint32_t{runs[i + 1]} + 1;
+    return card;
+}
+
+// ============= Owning Container =============
+
+struct container {
+    container_kind kind = container_kind::array;
+    uint32_t card = 0;
+    std::vector<uint16_t> data;
+    std::unique_ptr<block> bits;
+
+    container() = default;
+
+    container(const container& o)
+        : kind(o.kind), card(o.card), data(o.data),
+          bits(o.bits ? std::make_unique<block>(*o.bits) : nullptr) {}
+
+    container(container&&) noexcept = default;
+
+    container& operator=(const container& o) {
+        if (this != &o) *this = container(o);
+        return *this;
+    }
+
+    container& operator=(container&&) noexcept = default;
+
+    [[nodiscard]] container_ref ref() const noexcept {
+        return {kind, card, data.data(), static_cast<uint32_t>(data.size()), bits ? bits->data() : nullptr};
+    }
+
+    // ============= Factories =============
+
+    [[nodiscard]] static container from_values(std::vector<uint16_t> values) {
+        container c;
+        c.card = static_cast<uint32_t>(values.size());
+        c.data = std::move(values);
+        if (c.card > array_max) c.to_bitmap();
+        return c;
+    }
+
+    /** @brief Bitmap, atau array jika kardinalitas <= array_max */
+    [[nodiscard]] static container from_block(std::unique_ptr<block> b) {
+        container c;
+        c.kind = container_kind::bitmap;
+        c.card = static_cast<uint32_t>(simd::popcount(b->data(), block_bytes));
+        c.bits = std::move(b);
+        if (c.card <= array_max) c.to_array();
+        return c;
+    }
+
+    [[nodiscard]] static container from_runs(std::vector<uint16_t> runs) {
+        container c;
+        c.kind = container_kind::run;
+        c.card = run_cardinality(runs);
+        c.data = std::move(runs);
+        return c;
+    }
+
+    /** @brief Salinan dari container_ref (mis. dari roaring_view) */
+    [[nodiscard]] static container from_ref(const container_ref& r) {
+        container c;
+        c.kind = r.kind;
+        c.card = r.card;
+        if (r.kind == container_kind::bitmap) {
+            c.bits = std::make_unique<block>(r.bits, block_bytes);
+        } else {
+            c.data.assign(r.data, r.data + r.size);
+        }
+        return c;
+    }
+
+    // ============= Conversion =============
+
+    void to_bitmap() {
+        if (kind == container_kind::bitmap) return;
+        auto b = std::make_unique<block>();
+        or_into(b->data(), ref());
+        data = {};
+        bits = std::move(b);
+        kind = container_kind::bitmap;
+    }
+
+    void to_array() {
+        if (kind == container_kind::array) return;
+        data = values_of(ref());
+        bits.reset();
+        kind = container_kind::array;
+    }
+
+    /** @brief Array atau bitmap sesuai kardinalitas */
+    void to_natural() {
+        if (card <= array_max) to_array();
+        else to_bitmap();
+    }
+
+    /** @brief Pilih representasi terkecil (run jika lebih hemat) */
+    void run_optimize() {
+        std::vector<uint16_t> runs = runs_of(ref());
+        const size_t natural_bytes = card <= array_max ? card * sizeof(uint16_t) : block_bytes;
+        if (runs.size() * sizeof(uint16_t) < natural_bytes) {
+            data = std::move(runs);
+            bits.reset();
+            kind = container_kind::run;
+        } else {
+            to_natural();
+        }
+    }
+
+    // ============= Modifiers =============
+
+    bool add(uint16_t v) {
+        switch (kind) {
+        case container_kind::array: {
+            const auto it = std::lower_bound(data.begin(), data.end(), v);
+            if (it != data.end() && *it == v) return false;
+            if (card < array_max) {
+                data.insert(it, v);
+                ++card;
+                return true;
+            }
+            to_bitmap();
+            return add(v);
+        }
+        case container_kind::bitmap: {
+            uint8_t& byte = (*bits)[v / 8];
+            const auto mask = static_cast<uint8_t>(1u << (v % 8));
+            if (byte & mask) return false;
+            byte |= mask;
+            ++card;
+            return true;
+        }
+        case container_kind::run:
+            if (container_contains(ref(), v)) return false;
+            to_natural();
+            return add(v);
+        }
+        return false;
+    }
+
+    bool remove(uint16_t v) {
+        switch (kind) {
+        case container_kind::array: {
+            const auto it = std::lower_bound(data.begin(), data.end(), v);
+            if (it == data.end() || *it != v) return false;
+            data.erase(it);
+            --card;
+            return true;
+        }
+        case container_kind::bitmap: {
+            uint8_t& byte = (*bits)[v / 8];
+            const auto mask = static_cast<uint8_t>(1u << (v % 8));
+            if (!(byte & mask)) return false;
+            byte &= static_cast<uint8_t>(~mask);
+            if (--card <= array_max) to_array();
+            return true;
+        }
+        case container_kind::run:
+            if (!container_contains(ref(), v)) return false;
+            to_natural();
+            return remove(v);
+        }
+        return false;
+    }
+};
+
+// ============= Multi-way Combine =============
+
+[[nodiscard]] inline bool all_kind(std::span<const container_ref> refs, container_kind k) noexcept {
+    return std::all_of(refs.begin(), refs.end(), [k](const container_ref& r) { return r.kind == k; });
+}
+
+[[nodiscard]] inline std::vector<uint16_t> intersect_runs(const std::vector<uint16_t>& a,
+                                                          const uint16_t* b, uint32_t bn) {
+    std::vector<uint16_t> out;
+    size_t i = 0, j = 0;
+    while (i < a.size() && j < bn) {
+        const uint32_t as = a[i], ae = as + a[i + 1];
+        const uint32_t bs = b[j], be = bs + b[j + 1];
+        const uint32_t s = std::max(as, bs), e = std::min(ae, be);
+        if (s <= e) {
+            out.push_back(static_cast<uint16_t>(s));
+            out.push_back(static_cast<uint16_t>(e - s));
+        }
+        if (ae < be) i += 2;
+        else j += 2;
+    }
+    return out;
+}
+
+/** @brief Interseksi semua container (refs tidak kosong, card > 0) */
+[[nodiscard]] inline container and_refs(std::span<container_ref> refs) {
+    if (all_kind(refs, container_kind::run)) {
+        std::vector<uint16_t> acc(refs[0].data, refs[0].data + refs[0].size);
+        for (size_t i = 1; i < refs.size() && !acc.empty(); ++i) {
+            acc = intersect_runs(acc, refs[i].data, refs[i].size);
+        }
+        return container::from_runs(std::move(acc));
+    }
+
+    std::sort(refs.begin(), refs.end(),
+              [](const container_ref& a, const container_ref& b) { return a.card < b.card; });
+
+    // Container terkecil cukup sparse: saring nilainya lewat container lain
+    if (refs[0].card <= array_max) {
+        std::vector<uint16_t> cand = values_of(refs[0]);
+        for (size_t i = 1; i < refs.size() && !cand.empty(); ++i) filter(cand, refs[i]);
+        return container::from_values(std::move(cand));
+    }
+
+    // Semua dense: satu akumulator blok, AND in-place
+    auto acc = std::make_unique<block>();
+    or_into(acc->data(), refs[0]);
+    for (size_t i = 1; i < refs.size(); ++i) and_into(acc->data(), refs[i]);
+    return container::from_block(std::move(acc));
+}
+
+/** @brief Union semua container (refs tidak kosong) */
+[[nodiscard]] inline container or_refs(std::span<container_ref> refs) {
+    if (all_kind(refs, container_kind::run)) {
+        std::vector<std::pair<uint32_t, uint32_t>> spans;
+        for (const auto& r : refs)
+            for (uint32_t i = 0; i < r.size; i += 2) spans.emplace_back(r.data[i], uint32_t{r.data[i]} + r.data[i + 1]);
+        std::sort(spans.begin(), spans.end());
+
+        std::vector<uint16_t> runs;
+        uint32_t s = spans[0].first, e = spans[0].second;
+        for (size_t i = 1; i < spans.size(); ++i) {
+            if (spans[i].first <= e + 1) {
+                e = std::max(e, spans[i].second);
+                continue;
+            }
+            runs.push_back(static_cast<uint16_t>(s));
+            runs.push_back(static_cast<uint16_t>(e - s));
+            s = spans[i].first;
+            e = spans[i].second;
+        }
+        runs.push_back(static_cast<uint16_t>(s));
+        runs.push_back(static_cast<uint16_t>(e - s));
+        return container::from_runs(std::move(runs));
+    }
+
+    size_t total = 0;
+    for (const auto& r : refs) total += r.card;
+    if (total <= array_max && all_kind(refs, container_kind::array)) {
+        std::vector<uint16_t> merged;
+        merged.reserve(total);
+        for (const auto& r : refs) merged.insert(merged.end(), r.data, r.data + r.size);
+        std::sort(merged.begin(), merged.end());
+        merged.erase(std::unique(merged.begin(), merged.end()), merged.end());
+        return container::from_values(std::move(merged));
+    }
+
+    // Satu akumulator blok; kardinalitas dihitung sekali di akhir
+    auto acc = std::make_unique<block>();
+    for (const auto& r : refs) or_into(acc->data(), r);
+    return container::from_block(std::move(acc));
+}
+
+[[nodiscard]] inline bool equal(const container_ref& a, const container_ref& b) {
+    if (a.card != b.card) return false;
+    if (a.kind == b.kind) {
+        if (a.kind == container_kind::bitmap) return std::memcmp(a.bits, b.bits, block_bytes) == 0;
+        return a.size == b.size && std::equal(a.data, a.data + a.size, b.data);
+    }
+    block x, y;
+    or_into(x.data(), a);
+    or_into(y.data(), b);
+    return x == y;
+}
+
+// ============= Source Interface =============
+
+/** @brief Index container pertama dengan key >= key, mulai dari from */
+template <typename S>
+[[nodiscard]] size_t lower_bound_key(const S& s, uint16_t key, size_t from) noexcept {
+    size_t lo = from, hi = s.container_count();
+    while (lo < hi) {
+        const size_t mid = (lo + hi) / 2;
+        if (s.key_at(mid) < key) lo = mid + 1;
+        else hi = mid;
+    }
+    return lo;
+}
+
+/** @brief Query read-only bersama untuk roaring_bitmap dan roaring_view */
+template <typename Derived>
+class source_ops {
+    [[nodiscard]] const Derived& self() const noexcept { return static_cast<const Derived&>(*this); }
+
+public:
+    [[nodiscard]] bool empty() const noexcept { return self().container_count() == 0; }
+
+    [[nodiscard]] bool contains(uint32_t v) const noexcept {
+        const auto key = static_cast<uint16_t>(v >> 16);
+        const size_t i = lower_bound_key(self(), key, 0);
+        return i < self().container_count() && self().key_at(i) == key &&
+               container_contains(self().container_at(i), static_cast<uint16_t>(v));
+    }
+
+    [[nodiscard]] uint64_t cardinality() const noexcept {
+        uint64_t n = 0;
+        for (size_t i = 0; i < self().container_count(); ++i) n += self().container_at(i).card;
+        return n;
+    }
+
+    /** @brief Panggil f(value) untuk setiap nilai, ascending */
+    template <typename F>
+    void for_each(F&& f) const {
+        for (size_t i = 0; i < self().container_count(); ++i) {
+            const uint32_t base = uint32_t{self().key_at(i)} << 16;
+            for_each_value(self().container_at(i), [&](uint16_t low) { f(base | low); });
+        }
+    }
+
+    [[nodiscard]] std::vector<uint32_t> to_vector() const {
+        std::vector<uint32_t> out;
+        out.reserve(static_cast<size_t>(cardinality()));
+        for_each([&](uint32_t v) { out.push_back(v); });
+        return out;
+    }
+};
+
+/** @brief Akses append untuk and_many / or_many */
+struct builder {
+    static void append(roaring_bitmap& out, uint16_t key, container&& c);
+};
+
+// ============= Serial Format =============
+//
+// Little-endian, semua offset relatif ke awal buffer:
+//   [0]  uint32 magic, [4] uint32 jumlah container K
+//   [8]  K deskriptor 16 byte: uint16 key, uint8 kind, uint8 reserved,
+//        uint32 card, uint32 offset payload, uint32 jumlah uint16 payload
+//   payload tiap container aligned 8 byte
+
+inline constexpr uint32_t serial_magic = 0x3142525Au; // "ZRB1"
+inline constexpr size_t header_bytes = 8;
+inline constexpr size_t descriptor_bytes = 16;
+
+template <typename T>
+[[nodiscard]] inline T read_le(const uint8_t* p) noexcept {
+    T v;
+    std::memcpy(&v, p, sizeof(T));
+    return from_little_endian(v);
+}
+
+template <typename T>
+inline void write_le(uint8_t* p, T v) noexcept {
+    v = to_little_endian(v);
+    std::memcpy(p, &v, sizeof(T));
+}
+
+[[nodiscard]] constexpr size_t align8(size_t n) noexcept { return (n + 7) & ~size_t{7}; }
+
+} // namespace detail::roaring
+
+// ============= Source Concept =============
+
+/** @brief Tipe yang menyediakan container terurut berdasarkan key */
+template <typename S>
+concept roaring_source = requires(const S& s, size_t i) {
+    { s.container_count() } -> std::convertible_to<size_t>;
+    { s.key_at(i) } -> std::convertible_to<uint16_t>;
+    { s.container_at(i) } -> std::same_as<detail::roaring::container_ref>;
+};
+
+// ============= Roaring Bitmap =============
+
+/**
+ * @brief Himpunan uint32_t terkompresi (owning)
+ *
+ * Container disimpan terurut berdasarkan key 16 bit atas; container kosong
+ * selalu dihapus.
+ */
+class roaring_bitmap : public detail::roaring::source_ops<roaring_bitmap> {
+    using container = detail::roaring::container;
+    using container_ref = detail::roaring::container_ref;
+
+    std::vector<uint16_t> keys_;
+    std::vector<container> containers_;
+
+    friend struct detail::roaring::builder;
+
+    [[nodiscard]] size_t find(uint16_t key) const noexcept {
+        return static_cast<size_t>(std::lower_bound(keys_.begin(), keys_.end(), key) - keys_.begin());
+    }
+
+public:
+    // ============= Constructors =============
+
+    roaring_bitmap() = default;
+
+    roaring_bitmap(std::initializer_list<uint32_t> values) {
+        for (uint32_t v : values) add(v);
+    }
+
+    // ============= Source Interface =============
+
+    [[nodiscard]] size_t container_count() const noexcept { return keys_.size(); }
+    [[nodiscard]] uint16_t key_at(size_t i) const noexcept { return keys_[i]; }
+    [[nodiscard]] container_ref container_at(size_t i) const noexcept { return containers_[i].ref(); }
+
+    // ============= Modifiers =============
+
+    /** @brief Tambah nilai, return true jika sebelumnya belum ada */
+    bool add(uint32_t v) {
+        const auto key = static_cast<uint16_t>(v >> 16);
+        const size_t i = find(key);
+        if (i == keys_.size() || keys_[i] != key) {
+            keys_.insert(keys_.begin() + static_cast<std::ptrdiff_t>(i), key);
+            containers_.insert(containers_.begin() + static_cast<std::ptrdiff_t>(i), container{});
+        }
+        return containers_[i].add(static_cast<uint16_t>(v));
+    }
+
+    /** @brief Tambah semua nilai dalam [first, last] (inklusif) sebagai run */
+    void add_range(uint32_t first, uint32_t last) {
+        if (first > last) return;
+        for (uint32_t key = first >> 16;; ++key) {
+            const uint32_t lo = key == (first >> 16) ? (first & 0xFFFFu) : 0;
+            const uint32_t hi = key == (last >> 16) ? (last & 0xFFFFu) : 0xFFFFu;
+            container run = container::from_runs({static_cast<uint16_t>(lo), static_cast<uint16_t>(hi - lo)});
+
+            const auto k = static_cast<uint16_t>(key);
+            const size_t i = find(k);
+            if (i < keys_.size() && keys_[i] == k) {
+                container_ref refs[] = {containers_[i].ref(), run.ref()};
+                containers_[i] = detail::roaring::or_refs(refs);
+            } else {
+                keys_.insert(keys_.begin() + static_cast<std::ptrdiff_t>(i), k);
+                containers_.insert(containers_.begin() + static_cast<std::ptrdiff_t>(i), std::move(run));
+            }
+            if (key == (last >> 16)) break;
+        }
+    }
+
+    /** @brief Hapus nilai, return true jika sebelumnya ada */
+    bool remove(uint32_t v) {
+        const auto key = static_cast<uint16_t>(v >> 16);
+        const size_t i = find(key);
+        if (i == keys_.size() || keys_[i] != key) return false;
+        if (!containers_[i].remove(static_cast<uint16_t>(v))) return false;
+        if (containers_[i].card == 0) {
+            keys_.erase(keys_.begin() + static_cast<std::ptrdiff_t>(i));
+            containers_.erase(containers_.begin() + static_cast<std::ptrdiff_t>(i));
+        }
+        return true;
+    }
+
+    void clear() noexcept {
+        keys_.clear();
+        containers_.clear();
+    }
+
+    /** @brief Ubah container ke run jika lebih hemat (panggil setelah bulk load) */
+    void run_optimize() {
+        for (auto& c : containers_) c.run_optimize();
+    }
+
+    // ============= Set Operations =============
+
+    roaring_bitmap& operator&=(const roaring_bitmap& o);
+    roaring_bitmap& operator|=(const roaring_bitmap& o);
+
+    [[nodiscard]] friend bool operator==(const roaring_bitmap& a, const roaring_bitmap& b) {
+        if (a.keys_ != b.keys_) return false;
+        for (size_t i = 0; i < a.containers_.size(); ++i) {
+            if (!detail::roaring::equal(a.containers_[i].ref(), b.containers_[i].ref())) return false;
+        }
+        return true;
+    }
+
+    // ============= Serialization =============
+
+    /** @brief Ukuran format serial dalam byte */
+    [[nodiscard]] size_t serialized_size() const noexcept {
+        using namespace detail::roaring;
+        size_t off = header_bytes + descriptor_bytes * keys_.size();
+        for (const auto& c : containers_) {
+            off = align8(off) + (c.kind == container_kind::bitmap ? block_bytes : c.data.size() * sizeof(uint16_t));
+        }
+        return off;
+    }
+
+    /** @brief Serialisasi ke buffer (dapat ditulis ke file lalu di-mmap) */
+    [[nodiscard]] byte_buffer serialize() const {
+        using namespace detail::roaring;
+        byte_buffer buf(serialized_size());
+        uint8_t* const out = buf.data();
+        write_le<uint32_t>(out, serial_magic);
+        write_le<uint32_t>(out + 4, static_cast<uint32_t>(keys_.size()));
+
+        size_t off = header_bytes + descriptor_bytes * keys_.size();
+        for (size_t i = 0; i < keys_.size(); ++i) {
+            const container& c = containers_[i];
+            const bool dense = c.kind == container_kind::bitmap;
+            const auto count = static_cast<uint32_t>(dense ? block_bytes / sizeof(uint16_t) : c.data.size());
+            off = align8(off);
+
+            uint8_t* const d = out + header_bytes + descriptor_bytes * i;
+            write_le<uint16_t>(d, keys_[i]);
+            d[2] = static_cast<uint8_t>(c.kind);
+            write_le<uint32_t>(d + 4, c.card);
+            write_le<uint32_t>(d + 8, static_cast<uint32_t>(off));
+            write_le<uint32_t>(d + 12, count);
+
+            if (dense) {
+                std::memcpy(out + off, c.bits->data(), block_bytes);
+            } else {
+                for (size_t j = 0; j < c.data.size(); ++j) write_le<uint16_t>(out + off + 2 * j, c.data[j]);
+            }
+            off += count * sizeof(uint16_t);
+        }
+        return buf;
+    }
+
+    /** @brief Deserialisasi (salin) dari format serial */
+    [[nodiscard]] static roaring_bitmap deserialize(bytes_view buf);
+};
+
+inline void detail::roaring::builder::append(roaring_bitmap& out, uint16_t key, container&& c) {
+    if (c.card == 0) return;
+    out.keys_.push_back(key);
+    out.containers_.push_back(std::move(c));
+}
+
+// ============= Serialized View =============
+
+/**
+ * @brief View read-only atas format serial roaring_bitmap (zero-copy)
+ *
+ * Buffer divalidasi saat konstruksi (descriptor dan isi setiap container,
+ * lihat payload_valid); query (contains, for_each, and_many, or_many)
+ * membaca container langsung dari buffer.
+ *
+ * @note Buffer harus aligned 2 byte dan tetap hidup selama view dipakai
+ * @note Hanya untuk host little-endian (payload dibaca langsung sebagai uint16_t)
+ */
+class roaring_view : public detail::roaring::source_ops<roaring_view> {
+    using container_ref = detail::roaring::container_ref;
+
+    bytes_view buf_;
+    uint32_t count_ = 0;
+
+    [[nodiscard]] const uint8_t* descriptor(size_t i) const noexcept {
+        return buf_.data() + detail::roaring::header_bytes + detail::roaring::descriptor_bytes * i;
+    }
+
+public:
+    /** @throws std::invalid_argument jika buffer bukan format serial yang valid */
+    explicit roaring_view(bytes_view buf) : buf_(buf) {
+        static_assert(is_little_endian, "roaring_view reads serialized payloads in place (little-endian only)");
+        using namespace detail::roaring;
+
+        if (buf.size() < header_bytes || read_le<uint32_t>(buf.data()) != serial_magic) {
+            throw std::invalid_argument("roaring_view: bad magic");
+        }
+        if (reinterpret_cast<uintptr_t>(buf.data()) % alignof(uint16_t) != 0) {
+            throw std::invalid_argument("roaring_view: misaligned buffer");
+        }
+        count_ = read_le<uint32_t>(buf.data() + 4);
+        if (count_ > 65536 || header_bytes + descriptor_bytes * size_t{count_} > buf.size()) {
+            throw std::invalid_argument("roaring_view: truncated descriptors");
+        }
+
+        for (size_t i = 0; i < count_; ++i) {
+            const uint8_t* d = descriptor(i);
+            const auto kind = static_cast<container_kind>(d[2]);
+            const uint32_t card = read_le<uint32_t>(d + 4);
+            const size_t off = read_le<uint32_t>(d + 8);
+            const size_t count = read_le<uint32_t>(d + 12);
+
+            bool ok = off % alignof(uint16_t) == 0 && off + count * sizeof(uint16_t) <= buf.size() &&
+                      card > 0 && card <= 65536 && (i == 0 || key_at(i - 1) < key_at(i));
+            switch (kind) {
+            case container_kind::array: ok = ok && count == card && card <= array_max; break;
+            case container_kind::bitmap: ok = ok && count * sizeof(uint16_t) == block_bytes; break;
+            case container_kind::run: ok = ok && count % 2 == 0; break;
+            default: ok = false;
+            }
+            if (!ok) throw std::invalid_argument("roaring_view: corrupt container descriptor");
+            if (!payload_valid(container_at(i))) throw std::invalid_argument("roaring_view: corrupt container payload");
+        }
+    }
+
+    // ============= Source Interface =============
+
+    [[nodiscard]] size_t container_count() const noexcept { return count_; }
+
+    [[nodiscard]] uint16_t key_at(size_t i) const noexcept {
+        return detail::roaring::read_le<uint16_t>(descriptor(i));
+    }
+
+    [[nodiscard]] container_ref container_at(size_t i) const noexcept {
+        using namespace detail::roaring;
+        const uint8_t* d = descriptor(i);
+        const uint8_t* payload = buf_.data() + read_le<uint32_t>(d + 8);
+        container_ref r;
+        r.kind = static_cast<container_kind>(d[2]);
+        r.card = read_le<uint32_t>(d + 4);
+        if (r.kind == container_kind::bitmap) {
+            r.bits = payload;
+        } else {
+            r.data = reinterpret_cast<const uint16_t*>(payload);
+            r.size = read_le<uint32_t>(d + 12);
+        }
+        return r;
+    }
+
+    /** @brief Salin ke roaring_bitmap */
+    [[nodiscard]] roaring_bitmap to_bitmap() const {
+        roaring_bitmap out;
+        for (size_t i = 0; i < count_; ++i) {
+            detail::roaring::builder::append(out, key_at(i), detail::roaring::container::from_ref(container_at(i)));
+        }
+        return out;
+    }
+};
+
+inline roaring_bitmap roaring_bitmap::deserialize(bytes_view buf) {
+    return roaring_view(buf).to_bitmap();
+}
+
+// ============= Multi-way Operations =============
+
+/**
+ * @brief Interseksi banyak bitmap sekaligus
+ *
+ * Key dari input dengan container paling sedikit menjadi driver; per key
+ * container digabung dalam satu langkah (saring nilai jika ada container
+ * sparse, selain itu satu akumulator blok dengan AND in-place).
+ */
+template <roaring_source S>
+[[nodiscard]] roaring_bitmap and_many(std::span<const S* const> inputs) {
+    using namespace detail::roaring;
+    roaring_bitmap out;
+    if (inputs.empty()) return out;
+
+    const S* driver = *std::min_element(inputs.begin(), inputs.end(), [](const S* a, const S* b) {
+        return a->container_count() < b->container_count();
+    });
+
+    std::vector<size_t> cursor(inputs.size(), 0);
+    std::vector<container_ref> refs;
+    refs.reserve(inputs.size());
+
+    for (size_t d = 0; d < driver->container_count(); ++d) {
+        const uint16_t key = driver->key_at(d);
+        refs.clear();
+        bool all = true;
+        for (size_t k = 0; k < inputs.size() && all; ++k) {
+            const S& s = *inputs[k];
+            cursor[k] = lower_bound_key(s, key, cursor[k]);
+            all = cursor[k] < s.container_count() && s.key_at(cursor[k]) == key;
+            if (all) refs.push_back(s.container_at(cursor[k]));
+        }
+        if (all) builder::append(out, key, and_refs(refs));
+    }
+    return out;
+}
+
+template <roaring_source S>
+[[nodiscard]] roaring_bitmap and_many(std::initializer_list<const S*> inputs) {
+    return and_many(std::span<const S* const>(inputs.begin(), inputs.size()));
+}
+
+/**
+ * @brief Union banyak bitmap sekaligus
+ *
+ * Merge k-way atas key; container dengan key sama di-OR ke satu akumulator
+ * dan popcount dihitung sekali per key.
+ */
+template <roaring_source S>
+[[nodiscard]] roaring_bitmap or_many(std::span<const S* const> inputs) {
+    using namespace detail::roaring;
+    roaring_bitmap out;
+    std::vector<size_t> cursor(inputs.size(), 0);
+    std::vector<container_ref> refs;
+    refs.reserve(inputs.size());
+
+    for (;;) {
+        uint32_t key = 0x10000u;
+        for (size_t k = 0; k < inputs.size(); ++k) {
+            if (cursor[k] < inputs[k]->container_count()) key = std::min<uint32_t>(key, inputs[k]->key_at(cursor[k]));
+        }
+        if (key == 0x10000u) break;
+
+        refs.clear();
+        for (size_t k = 0; k < inputs.size(); ++k) {
+            const S& s = *inputs[k];
+            if (cursor[k] < s.container_count() && s.key_at(cursor[k]) == key) refs.push_back(s.container_at(cursor[k]++));
+        }
+        builder::append(out, static_cast<uint16_t>(key),
+                        refs.size() == 1 ? container::from_ref(refs[0]) : or_refs(refs));
+    }
+    return out;
+}
+
+template <roaring_source S>
+[[nodiscard]] roaring_bitmap or_many(std::initializer_list<const S*> inputs) {
+    return or_many(std::span<const S* const>(inputs.begin(), inputs.size()));
+}
+
+// ============= Binary Operators =============
+
+[[nodiscard]] inline roaring_bitmap operator&(const roaring_bitmap& a, const roaring_bitmap& b) {
+    return and_many({&a, &b});
+}
+
+[[nodiscard]] inline roaring_bitmap operator|(const roaring_bitmap& a, const roaring_bitmap& b) {
+    return or_many({&a, &b});
+}
+
+inline roaring_bitmap& roaring_bitmap::operator&=(const roaring_bitmap& o) {
+    *this = *this & o;
+    return *this;
+}
+
+inline roaring_bitmap& roaring_bitmap::operator|=(const roaring_bitmap& o) {
+    *this = *this | o;
+    return *this;
+}
+
+} // namespace zuu
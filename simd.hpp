@@ -0,0 +1,431 @@
+#pragma once
+
+/**
+ * @file simd.hpp
+ * @brief Kernel SIMD dengan runtime ISA dispatch
+ * @version 1.0.0
+ *
+ * Menyediakan:
+ * - Deteksi fitur CPU (sekali per proses)
+ * - Kernel bitwise (OR/AND/XOR/NOT) untuk SSE2, AVX2, AVX-512 dan fallback
+ *   word-at-a-time (64-bit) untuk platform lain
+ * - Kernel popcount (POPCNT, AVX-512 VPOPCNTDQ)
+ * - Bit gather/scatter per limb 64-bit (BMI2 pext/pdep, fallback per run bit)
+ *
+ * Kernel dipilih sekali saat pemanggilan pertama, sehingga satu binary
+ * memakai ISA terbaik yang tersedia di mesin target.
+ *
+ * @note Dipakai oleh bytes.hpp; tidak constexpr (gunakan jalur scalar
+ *       saat std::is_constant_evaluated())
+ */
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#  define ZUU_SIMD_X86 1
+#  define ZUU_TARGET(isa) __attribute__((target(isa)))
+#  include <immintrin.h>
+#else
+#  define ZUU_TARGET(isa)
+#endif
+
+namespace zuu {
+
+namespace simd {
+
+// ============= CPU Features =============
+
+/** @brief Fitur ISA yang relevan untuk kernel library */
+struct cpu_features {
+    bool sse2 = false;
+    bool ssse3 = false;
+    bool sse42 = false;
+    bool popcnt = false;
+    bool pclmul = false;
+    bool avx2 = false;
+    bool bmi2 = false;
+    bool fast_pdep = false;  ///< bmi2 dan pext/pdep tidak microcoded (bukan Zen1/Zen2)
+    bool avx512f = false;
+    bool avx512bw = false;
+    bool avx512vpopcntdq = false;
+    bool gfni = false;
+};
+
+/** @brief Fitur CPU saat ini (dideteksi sekali) */
+[[nodiscard]] inline const cpu_features& cpu() noexcept {
+    static const cpu_features f = [] {
+        cpu_features r;
+#ifdef ZUU_SIMD_X86
+        __builtin_cpu_init();
+        r.sse2 = __builtin_cpu_supports("sse2");
+        r.ssse3 = __builtin_cpu_supports("ssse3");
+        r.sse42 = __builtin_cpu_supports("sse4.2");
+        r.popcnt = __builtin_cpu_supports("popcnt");
+        r.pclmul = __builtin_cpu_supports("pclmul");
+        r.avx2 = __builtin_cpu_supports("avx2");
+        r.bmi2 = __builtin_cpu_supports("bmi2");
+        r.fast_pdep = r.bmi2 && !__builtin_cpu_is("znver1") && !__builtin_cpu_is("znver2");
+        r.avx512f = __builtin_cpu_supports("avx512f");
+        r.avx512bw = __builtin_cpu_supports("avx512bw");
+        r.avx512vpopcntdq = __builtin_cpu_supports("avx512vpopcntdq");
+        r.gfni = __builtin_cpu_supports("gfni");
+#endif
+        return r;
+    }();
+    return f;
+}
+
+// ============= Word Access =============
+
+/** @brief Load 64-bit word (unaligned, native endian) */
+[[nodiscard]] inline uint64_t load_u64(const uint8_t* p) noexcept {
+    uint64_t v;
+    std::memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+/** @brief Store 64-bit word (unaligned, native endian) */
+inline void store_u64(uint8_t* p, uint64_t v) noexcept {
+    std::memcpy(p, &v, sizeof(v));
+}
+
+// ============= Bitwise Kernels =============
+
+/** @brief Operasi bitwise elementwise */
+enum class bit_op { or_, and_, xor_, not_ };
+
+/** @brief Ukuran minimum (byte) dimana dispatch ke kernel vektor menguntungkan */
+inline constexpr size_t dispatch_threshold = 256;
+
+/** @brief Terapkan op ke satu elemen (b diabaikan untuk not_) */
+template <bit_op Op, typename T>
+[[nodiscard]] constexpr T apply(T a, T b) noexcept {
+    if constexpr (Op == bit_op::or_) return static_cast<T>(a | b);
+    else if constexpr (Op == bit_op::and_) return static_cast<T>(a & b);
+    else if constexpr (Op == bit_op::xor_) return static_cast<T>(a ^ b);
+    else return static_cast<T>(~a);
+}
+
+/**
+ * @brief Kernel portable: 64-bit word lalu tail per byte
+ * @note dst boleh sama dengan a atau b (elementwise)
+ */
+template <bit_op Op>
+inline void bitwise_words(uint8_t* dst, const uint8_t* a, const uint8_t* b, size_t n) noexcept {
+    size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+        store_u64(dst + i, apply<Op>(load_u64(a + i), Op == bit_op::not_ ? 0 : load_u64(b + i)));
+    }
+    for (; i < n; ++i) {
+        dst[i] = apply<Op>(a[i], Op == bit_op::not_ ? uint8_t{0} : b[i]);
+    }
+}
+
+namespace detail {
+
+using bitwise_fn = void (*)(uint8_t*, const uint8_t*, const uint8_t*, size_t) noexcept;
+
+#ifdef ZUU_SIMD_X86
+
+template <bit_op Op>
+ZUU_TARGET("sse2")
+void bitwise_sse2(uint8_t* dst, const uint8_t* a, const uint8_t* b, size_t n) noexcept {
+    const __m128i ones = _mm_set1_epi32(-1);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        const __m128i x = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+        __m128i r;
+        if constexpr (Op == bit_op::not_) {
+            r = _mm_xor_si128(x, ones);
+        } else {
+            const __m128i y = _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+            if constexpr (Op == bit_op::or_) r = _mm_or_si128(x, y);
+            else if constexpr (Op == bit_op::and_) r = _mm_and_si128(x, y);
+            else r = _mm_xor_si128(x, y);
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), r);
+    }
+    bitwise_words<Op>(dst + i, a + i, b + i, n - i);
+}
+
+template <bit_op Op>
+ZUU_TARGET("avx2")
+void bitwise_avx2(uint8_t* dst, const uint8_t* a, const uint8_t* b, size_t n) noexcept {
+    const __m256i ones = _mm256_set1_epi32(-1);
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i));
+        __m256i r;
+        if constexpr (Op == bit_op::not_) {
+            r = _mm256_xor_si256(x, ones);
+        } else {
+            const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + i));
+            if constexpr (Op == bit_op::or_) r = _mm256_or_si256(x, y);
+            else if constexpr (Op == bit_op::and_) r = _mm256_and_si256(x, y);
+            else r = _mm256_xor_si256(x, y);
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), r);
+    }
+    bitwise_words<Op>(dst + i, a + i, b + i, n - i);
+}
+
+template <bit_op Op>
+ZUU_TARGET("avx512f")
+void bitwise_avx512(uint8_t* dst, const uint8_t* a, const uint8_t* b, size_t n) noexcept {
+    const __m512i ones = _mm512_set1_epi32(-1);
+    size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        const __m512i x = _mm512_loadu_si512(a + i);
+        __m512i r;
+        if constexpr (Op == bit_op::not_) {
+            r = _mm512_xor_si512(x, ones);
+        } else {
+            const __m512i y = _mm512_loadu_si512(b + i);
+            if constexpr (Op == bit_op::or_) r = _mm512_or_si512(x, y);
+            else if constexpr (Op == bit_op::and_) r = _mm512_and_si512(x, y);
+            else r = _mm512_xor_si512(x, y);
+        }
+        _mm512_storeu_si512(dst + i, r);
+    }
+    bitwise_words<Op>(dst + i, a + i, b + i, n - i);
+}
+
+#endif // ZUU_SIMD_X86
+
+template <bit_op Op>
+[[nodiscard]] inline bitwise_fn select_bitwise() noexcept {
+#ifdef ZUU_SIMD_X86
+    const auto& f = cpu();
+    if (f.avx512f) return &bitwise_avx512<Op>;
+    if (f.avx2) return &bitwise_avx2<Op>;
+    if (f.sse2) return &bitwise_sse2<Op>;
+#endif
+    return &bitwise_words<Op>;
+}
+
+} // namespace detail
+
+/**
+ * @brief Kernel bitwise dengan ISA terbaik yang tersedia
+ * @param dst Output (n byte), boleh sama dengan a atau b
+ * @param b Operand kedua (diabaikan untuk bit_op::not_)
+ */
+template <bit_op Op>
+inline void bitwise(uint8_t* dst, const uint8_t* a, const uint8_t* b, size_t n) noexcept {
+    static const detail::bitwise_fn fn = detail::select_bitwise<Op>();
+    fn(dst, a, b, n);
+}
+
+// ============= Popcount Kernels =============
+
+/** @brief Popcount portable per 64-bit word */
+[[nodiscard]] inline size_t popcount_words(const uint8_t* p, size_t n) noexcept {
+    size_t c = 0, i = 0;
+    for (; i + 8 <= n; i += 8) c += static_cast<size_t>(std::popcount(load_u64(p + i)));
+    for (; i < n; ++i) c += static_cast<size_t>(std::popcount(p[i]));
+    return c;
+}
+
+namespace detail {
+
+using popcount_fn = size_t (*)(const uint8_t*, size_t) noexcept;
+
+#ifdef ZUU_SIMD_X86
+
+ZUU_TARGET("popcnt")
+inline size_t popcount_popcnt(const uint8_t* p, size_t n) noexcept {
+    // 4 akumulator independen agar popcnt tidak terserialisasi
+    uint64_t c0 = 0, c1 = 0, c2 = 0, c3 = 0;
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        c0 += static_cast<uint64_t>(std::popcount(load_u64(p + i)));
+        c1 += static_cast<uint64_t>(std::popcount(load_u64(p + i + 8)));
+        c2 += static_cast<uint64_t>(std::popcount(load_u64(p + i + 16)));
+        c3 += static_cast<uint64_t>(std::popcount(load_u64(p + i + 24)));
+    }
+    for (; i + 8 <= n; i += 8) c0 += static_cast<uint64_t>(std::popcount(load_u64(p + i)));
+    for (; i < n; ++i) c0 += static_cast<uint64_t>(std::popcount(p[i]));
+    return static_cast<size_t>(c0 + c1 + c2 + c3);
+}
+
+ZUU_TARGET("avx512f,avx512vpopcntdq")
+inline size_t popcount_avx512(const uint8_t* p, size_t n) noexcept {
+    __m512i acc = _mm512_setzero_si512();
+    size_t i = 0;
+    for (; i + 64 <= n; i += 64) {
+        acc = _mm512_add_epi64(acc, _mm512_popcnt_epi64(_mm512_loadu_si512(p + i)));
+    }
+    alignas(64) uint64_t lanes[8];
+    _mm512_store_si512(lanes, acc);
+    uint64_t c = 0;
+    for (uint64_t v : lanes) c += v;
+    return static_cast<size_t>(c) + popcount_popcnt(p + i, n - i);
+}
+
+#endif // ZUU_SIMD_X86
+
+[[nodiscard]] inline popcount_fn select_popcount() noexcept {
+#ifdef ZUU_SIMD_X86
+    const auto& f = cpu();
+    if (f.avx512vpopcntdq) return &popcount_avx512;
+    if (f.popcnt) return &popcount_popcnt;
+#endif
+    return &popcount_words;
+}
+
+} // namespace detail
+
+/** @brief Jumlah bit set dalam p[0..n) dengan ISA terbaik yang tersedia */
+[[nodiscard]] inline size_t popcount(const uint8_t* p, size_t n) noexcept {
+    static const detail::popcount_fn fn = detail::select_popcount();
+    return fn(p, n);
+}
+
+// ============= Bit Gather / Scatter =============
+
+/**
+ * @brief pext portable: bit x pada posisi set di m, dipadatkan ke bit rendah
+ * @note O(jumlah run bit 1 di m), bukan O(popcount(m))
+ */
+[[nodiscard]] constexpr uint64_t pext_soft(uint64_t x, uint64_t m) noexcept {
+    uint64_t r = 0;
+    unsigned k = 0;
+    while (m != 0) {
+        const unsigned s = static_cast<unsigned>(std::countr_zero(m));
+        const unsigned len = static_cast<unsigned>(std::countr_one(m >> s));
+        const uint64_t field = len == 64 ? x : (x >> s) & ((uint64_t{1} << len) - 1);
+        r |= field << k;
+        k += len;
+        m = s + len == 64 ? 0 : m & (~uint64_t{0} << (s + len));
+    }
+    return r;
+}
+
+/** @brief pdep portable: bit rendah x disebar ke posisi set di m */
+[[nodiscard]] constexpr uint64_t pdep_soft(uint64_t x, uint64_t m) noexcept {
+    uint64_t r = 0;
+    unsigned k = 0;
+    while (m != 0) {
+        const unsigned s = static_cast<unsigned>(std::countr_zero(m));
+        const unsigned len = static_cast<unsigned>(std::countr_one(m >> s));
+        const uint64_t field = len == 64 ? x : (x >> k) & ((uint64_t{1} << len) - 1);
+        r |= field << s;
+        k += len;
+        m = s + len == 64 ? 0 : m & (~uint64_t{0} << (s + len));
+    }
+    return r;
+}
+
+namespace detail {
+
+/** @brief Tulis c bit v (c <= 64) ke bitstream out pada posisi pos */
+constexpr void put_bits(uint64_t* out, size_t pos, uint64_t v, unsigned c) noexcept {
+    if (c == 0) return;
+    const unsigned off = static_cast<unsigned>(pos % 64);
+    out[pos / 64] |= v << off;
+    if (off != 0 && off + c > 64) out[pos / 64 + 1] |= v >> (64 - off);
+}
+
+/** @brief Baca c bit (c <= 64) dari bitstream x[0..n) pada posisi pos */
+[[nodiscard]] constexpr uint64_t get_bits(const uint64_t* x, size_t n, size_t pos, unsigned c) noexcept {
+    if (c == 0) return 0;
+    const unsigned off = static_cast<unsigned>(pos % 64);
+    uint64_t v = x[pos / 64] >> off;
+    if (off != 0 && off + c > 64 && pos / 64 + 1 < n) v |= x[pos / 64 + 1] << (64 - off);
+    return c == 64 ? v : v & ((uint64_t{1} << c) - 1);
+}
+
+using gather_fn = void (*)(const uint64_t*, const uint64_t*, uint64_t*, size_t) noexcept;
+
+// Kedua kernel ditulis ulang per ISA (bukan template) agar pext/pdep
+// ter-inline ke dalam fungsi ber-target bmi2.
+
+constexpr void extract_limbs_soft(const uint64_t* x, const uint64_t* m, uint64_t* out, size_t n) noexcept {
+    size_t pos = 0;
+    for (size_t i = 0; i < n; ++i) {
+        put_bits(out, pos, pext_soft(x[i], m[i]), static_cast<unsigned>(std::popcount(m[i])));
+        pos += static_cast<size_t>(std::popcount(m[i]));
+    }
+}
+
+constexpr void deposit_limbs_soft(const uint64_t* x, const uint64_t* m, uint64_t* out, size_t n) noexcept {
+    size_t pos = 0;
+    for (size_t i = 0; i < n; ++i) {
+        const unsigned c = static_cast<unsigned>(std::popcount(m[i]));
+        out[i] = pdep_soft(get_bits(x, n, pos, c), m[i]);
+        pos += c;
+    }
+}
+
+inline void extract_limbs_soft_rt(const uint64_t* x, const uint64_t* m, uint64_t* out, size_t n) noexcept {
+    extract_limbs_soft(x, m, out, n);
+}
+
+inline void deposit_limbs_soft_rt(const uint64_t* x, const uint64_t* m, uint64_t* out, size_t n) noexcept {
+    deposit_limbs_soft(x, m, out, n);
+}
+
+#if defined(ZUU_SIMD_X86) && defined(__x86_64__)
+
+ZUU_TARGET("bmi2,popcnt")
+inline void extract_limbs_bmi2(const uint64_t* x, const uint64_t* m, uint64_t* out, size_t n) noexcept {
+    size_t pos = 0;
+    for (size_t i = 0; i < n; ++i) {
+        const unsigned c = static_cast<unsigned>(std::popcount(m[i]));
+        put_bits(out, pos, _pext_u64(x[i], m[i]), c);
+        pos += c;
+    }
+}
+
+ZUU_TARGET("bmi2,popcnt")
+inline void deposit_limbs_bmi2(const uint64_t* x, const uint64_t* m, uint64_t* out, size_t n) noexcept {
+    size_t pos = 0;
+    for (size_t i = 0; i < n; ++i) {
+        const unsigned c = static_cast<unsigned>(std::popcount(m[i]));
+        out[i] = _pdep_u64(get_bits(x, n, pos, c), m[i]);
+        pos += c;
+    }
+}
+
+#endif
+
+[[nodiscard]] inline gather_fn select_extract() noexcept {
+#if defined(ZUU_SIMD_X86) && defined(__x86_64__)
+    if (cpu().fast_pdep) return &extract_limbs_bmi2;
+#endif
+    return &extract_limbs_soft_rt;
+}
+
+[[nodiscard]] inline gather_fn select_deposit() noexcept {
+#if defined(ZUU_SIMD_X86) && defined(__x86_64__)
+    if (cpu().fast_pdep) return &deposit_limbs_bmi2;
+#endif
+    return &deposit_limbs_soft_rt;
+}
+
+} // namespace detail
+
+/**
+ * @brief Gather: bit x pada posisi set di m (n limb), dipadatkan ke out
+ * @param out n limb, harus nol sebelum dipanggil
+ */
+inline void extract_bits(const uint64_t* x, const uint64_t* m, uint64_t* out, size_t n) noexcept {
+    static const detail::gather_fn fn = detail::select_extract();
+    fn(x, m, out, n);
+}
+
+/**
+ * @brief Scatter: bit rendah x (n limb) disebar ke posisi set di m
+ * @param out n limb (ditimpa)
+ */
+inline void deposit_bits(const uint64_t* x, const uint64_t* m, uint64_t* out, size_t n) noexcept {
+    static const detail::gather_fn fn = detail::select_deposit();
+    fn(x, m, out, n);
+}
+
+} // namespace simd
+
+} // namespace zuu
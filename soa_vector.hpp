@@ -0,0 +1,457 @@
+#pragma once
+
+/**
+ * @file soa_vector.hpp
+ * @brief Struct-of-arrays container berbasis type_list_t
+ * @version 1.0.0
+ *
+ * Menyimpan setiap field dalam kolom terpisah yang aligned ke cache line,
+ * sehingga scan yang hanya menyentuh sebagian field tidak ikut membaca
+ * field lain. Mendukung import/export dari array-of-structs (AoS).
+ *
+ * @note Semua field harus trivially copyable
+ */
+
+#include "typelist.hpp"
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace zuu {
+
+namespace detail {
+
+/**
+ * @brief Layout struct C (standard layout) untuk urutan field Ts...
+ *
+ * Menghitung offset setiap field dengan aturan yang sama seperti compiler
+ * untuk struct standard-layout tanpa base class.
+ */
+template <typename... Ts>
+struct aos_layout {
+    static constexpr size_t count = sizeof...(Ts);
+    static constexpr size_t align = type_list_t<Ts...>::max_align;
+
+    static constexpr auto offsets = []() constexpr {
+        constexpr size_t sizes[] = {sizeof(Ts)...};
+        constexpr size_t aligns[] = {alignof(Ts)...};
+        struct { size_t value[count]; } r{};
+        size_t off = 0;
+        for (size_t i = 0; i < count; ++i) {
+            off = align_up(off, aligns[i]);
+            r.value[i] = off;
+            off += sizes[i];
+        }
+        return r;
+    }();
+
+    static constexpr size_t size = [] {
+        constexpr size_t sizes[] = {sizeof(Ts)...};
+        return align_up(offsets.value[count - 1] + sizes[count - 1], align);
+    }();
+};
+
+/** @brief Hanya bisa dikonversi ke T persis (tanpa promosi/konversi lain) */
+template <typename T>
+struct aos_exact_field {
+    template <typename U>
+    requires std::is_same_v<U, T>
+    constexpr operator U() const noexcept;
+};
+
+/** @brief Bisa dikonversi ke tipe apa pun (deteksi field tambahan) */
+struct aos_any_field {
+    template <typename U>
+    constexpr operator U() const noexcept;
+};
+
+} // namespace detail
+
+/**
+ * @brief Cek apakah Struct memiliki field Ts... persis, dalam urutan yang sama
+ *
+ * Struct harus aggregate standard-layout yang trivially copyable. Tipe field
+ * dicek lewat aggregate initialization dengan initializer yang hanya bisa
+ * dikonversi ke Ts persis, dan field tambahan ditolak. Karena tipe dan
+ * urutan sama, offset setiap field = aos_layout<Ts...>::offsets; ukuran dan
+ * alignment juga dicek untuk menolak alignas / packing non-standar.
+ *
+ * @note Field array C (T[N]) tidak didukung; pakai std::array
+ */
+template <typename Struct, typename... Ts>
+concept aos_compatible =
+    std::is_trivially_copyable_v<Struct> &&
+    std::is_standard_layout_v<Struct> &&
+    std::is_aggregate_v<Struct> &&
+    requires { Struct{detail::aos_exact_field<Ts>{}...}; } &&
+    !requires { Struct{detail::aos_exact_field<Ts>{}..., detail::aos_any_field{}}; } &&
+    sizeof(Struct) == detail::aos_layout<Ts...>::size &&
+    alignof(Struct) == detail::aos_layout<Ts...>::align;
+
+/**
+ * @brief Struct-of-arrays container
+ * @tparam Ts Tipe field (min 1, semua harus trivially copyable)
+ *
+ * Memory layout:
+ * - Satu kolom per field, masing-masing aligned ke column_align (64 byte)
+ * - Semua kolom memiliki capacity yang sama
+ *
+ * @example
+ * ```cpp
+ * struct Trade { uint64_t id; double price; uint32_t qty; };
+ * soa_vector<uint64_t, double, uint32_t> v;
+ * v.push_back(Trade{1, 10.5, 100});
+ * double sum = 0;
+ * for (double p : v.column<1>()) sum += p;  // hanya kolom price dibaca
+ * ```
+ */
+template <typename... Ts>
+requires (sizeof...(Ts) > 0)
+class soa_vector {
+    static_assert((std::is_trivially_copyable_v<Ts> && ...),
+        "All field types must be trivially copyable");
+
+public:
+    // ============= Type Aliases =============
+    using list_t = type_list_t<Ts...>;
+    using layout_t = detail::aos_layout<Ts...>;
+    using size_type = size_t;
+
+    template <size_t I>
+    using field_type = typename list_t::template type<I>;
+
+    static constexpr size_type field_count = sizeof...(Ts);
+    static constexpr size_type column_align = 64;
+
+    /** @brief Jumlah baris per tile saat transpose AoS <-> SoA */
+    static constexpr size_type transpose_tile = 256;
+
+private:
+    static constexpr size_type field_sizes[] = {sizeof(Ts)...};
+
+    uint8_t* columns_[field_count]{};
+    size_type size_ = 0;
+    size_type capacity_ = 0;
+
+    // ============= Internal Helpers =============
+
+    [[nodiscard]] static uint8_t* allocate_column(size_type bytes_len) {
+        return static_cast<uint8_t*>(
+            ::operator new(bytes_len, std::align_val_t{column_align}));
+    }
+
+    static void deallocate_column(uint8_t* p) noexcept {
+        if (p) ::operator delete(p, std::align_val_t{column_align});
+    }
+
+    void release() noexcept {
+        for (auto*& c : columns_) {
+            deallocate_column(c);
+            c = nullptr;
+        }
+        size_ = capacity_ = 0;
+    }
+
+    void reallocate(size_type new_cap) {
+        uint8_t* fresh[field_count]{};
+        try {
+            for (size_type f = 0; f < field_count; ++f)
+                fresh[f] = allocate_column(new_cap * field_sizes[f]);
+        } catch (...) {
+            for (auto* c : fresh) deallocate_column(c);
+            throw;
+        }
+        for (size_type f = 0; f < field_count; ++f) {
+            if (size_) std::memcpy(fresh[f], columns_[f], size_ * field_sizes[f]);
+            deallocate_column(columns_[f]);
+            columns_[f] = fresh[f];
+        }
+        capacity_ = new_cap;
+    }
+
+    void grow_for(size_type n) {
+        if (n <= capacity_) return;
+        size_type cap = capacity_ ? capacity_ * 2 : 16;
+        while (cap < n) cap *= 2;
+        reallocate(cap);
+    }
+
+    template <size_t... Is>
+    void store_row(size_type row, const Ts&... values, std::index_sequence<Is...>) noexcept {
+        (std::memcpy(columns_[Is] + row * field_sizes[Is], &values, field_sizes[Is]), ...);
+    }
+
+    /**
+     * @brief Salin field I dari n baris AoS ke kolom (mulai baris first)
+     * @note Ukuran field, offset, dan stride konstanta compile-time: memcpy
+     *       menjadi satu load/store dan loop dapat divektorisasi
+     */
+    template <size_t I>
+    void scatter_field(const uint8_t* src, size_type first, size_type n) noexcept {
+        constexpr size_type fs = sizeof(field_type<I>);
+        constexpr size_type off = layout_t::offsets.value[I];
+        constexpr size_type stride = layout_t::size;
+        uint8_t* out = columns_[I] + first * fs;
+        for (size_type r = 0; r < n; ++r) std::memcpy(out + r * fs, src + r * stride + off, fs);
+    }
+
+    template <size_t I>
+    void gather_field(uint8_t* dst, size_type first, size_type n) const noexcept {
+        constexpr size_type fs = sizeof(field_type<I>);
+        constexpr size_type off = layout_t::offsets.value[I];
+        constexpr size_type stride = layout_t::size;
+        const uint8_t* in = columns_[I] + first * fs;
+        for (size_type r = 0; r < n; ++r) std::memcpy(dst + r * stride + off, in + r * fs, fs);
+    }
+
+    /** @brief Transpose baris AoS [first, first + n) ke kolom */
+    template <size_t... Is>
+    void scatter_rows(const uint8_t* src, size_type first, size_type n, std::index_sequence<Is...>) noexcept {
+        for (size_type t = 0; t < n; t += transpose_tile) {
+            const size_type rows = n - t < transpose_tile ? n - t : transpose_tile;
+            const uint8_t* tile = src + t * layout_t::size;
+            (scatter_field<Is>(tile, first + t, rows), ...);
+        }
+    }
+
+    void scatter_rows(const uint8_t* src, size_type first, size_type n) noexcept {
+        scatter_rows(src, first, n, std::index_sequence_for<Ts...>{});
+    }
+
+    /** @brief Transpose kolom [first, first + n) ke baris AoS */
+    template <size_t... Is>
+    void gather_rows(uint8_t* dst, size_type first, size_type n, std::index_sequence<Is...>) const noexcept {
+        for (size_type t = 0; t < n; t += transpose_tile) {
+            const size_type rows = n - t < transpose_tile ? n - t : transpose_tile;
+            uint8_t* tile = dst + t * layout_t::size;
+            (gather_field<Is>(tile, first + t, rows), ...);
+        }
+    }
+
+    void gather_rows(uint8_t* dst, size_type first, size_type n) const noexcept {
+        gather_rows(dst, first, n, std::index_sequence_for<Ts...>{});
+    }
+
+public:
+    // ============= Row Proxy =============
+
+    /**
+     * @brief Proxy ke satu baris (mutable atau const)
+     * @tparam Const true untuk read-only proxy
+     */
+    template <bool Const>
+    class basic_row_ref {
+        using owner_t = std::conditional_t<Const, const soa_vector, soa_vector>;
+        owner_t* owner_;
+        size_type row_;
+
+    public:
+        constexpr basic_row_ref(owner_t* owner, size_type row) noexcept
+            : owner_(owner), row_(row) {}
+
+        /** @brief Akses field ke-I dari baris ini */
+        template <size_t I>
+        requires (I < field_count)
+        [[nodiscard]] auto& get() const noexcept {
+            return owner_->template column<I>()[row_];
+        }
+
+        /** @brief Index baris */
+        [[nodiscard]] constexpr size_type index() const noexcept { return row_; }
+
+        /** @brief Salin baris ke struct AoS */
+        template <typename Struct>
+        requires aos_compatible<Struct, Ts...>
+        [[nodiscard]] Struct to() const noexcept {
+            Struct s;
+            owner_->gather_rows(reinterpret_cast<uint8_t*>(&s), row_, 1);
+            return s;
+        }
+
+        /** @brief Assign seluruh baris dari struct AoS */
+        template <typename Struct>
+        requires (!Const && aos_compatible<Struct, Ts...>)
+        const basic_row_ref& operator=(const Struct& s) const noexcept {
+            owner_->scatter_rows(reinterpret_cast<const uint8_t*>(&s), row_, 1);
+            return *this;
+        }
+    };
+
+    using row_ref = basic_row_ref<false>;
+    using const_row_ref = basic_row_ref<true>;
+
+    // ============= Constructors =============
+
+    soa_vector() noexcept = default;
+
+    explicit soa_vector(size_type n) { resize(n); }
+
+    soa_vector(const soa_vector& o) {
+        if (o.size_ == 0) return;
+        reallocate(o.size_);
+        for (size_type f = 0; f < field_count; ++f)
+            std::memcpy(columns_[f], o.columns_[f], o.size_ * field_sizes[f]);
+        size_ = o.size_;
+    }
+
+    soa_vector(soa_vector&& o) noexcept
+        : size_(std::exchange(o.size_, 0)), capacity_(std::exchange(o.capacity_, 0)) {
+        for (size_type f = 0; f < field_count; ++f)
+            columns_[f] = std::exchange(o.columns_[f], nullptr);
+    }
+
+    soa_vector& operator=(const soa_vector& o) {
+        if (this != &o) {
+            soa_vector tmp(o);
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    soa_vector& operator=(soa_vector&& o) noexcept {
+        if (this != &o) {
+            release();
+            soa_vector tmp(std::move(o));
+            swap(tmp);
+        }
+        return *this;
+    }
+
+    ~soa_vector() { release(); }
+
+    // ============= Capacity =============
+
+    [[nodiscard]] size_type size() const noexcept { return size_; }
+    [[nodiscard]] size_type capacity() const noexcept { return capacity_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    /** @brief Ukuran satu baris jika disimpan sebagai struct AoS */
+    [[nodiscard]] static constexpr size_type row_size() noexcept { return layout_t::size; }
+
+    void reserve(size_type n) {
+        if (n > capacity_) reallocate(n);
+    }
+
+    /** @brief Resize; baris baru di-zero-initialize */
+    void resize(size_type n) {
+        grow_for(n);
+        if (n > size_) {
+            for (size_type f = 0; f < field_count; ++f)
+                std::memset(columns_[f] + size_ * field_sizes[f], 0, (n - size_) * field_sizes[f]);
+        }
+        size_ = n;
+    }
+
+    void shrink_to_fit() {
+        if (size_ == 0) release();
+        else if (size_ < capacity_) reallocate(size_);
+    }
+
+    void clear() noexcept { size_ = 0; }
+
+    // ============= Column Access =============
+
+    /** @brief Span ke kolom field ke-I */
+    template <size_t I>
+    requires (I < field_count)
+    [[nodiscard]] std::span<field_type<I>> column() noexcept {
+        return {data<I>(), size_};
+    }
+
+    template <size_t I>
+    requires (I < field_count)
+    [[nodiscard]] std::span<const field_type<I>> column() const noexcept {
+        return {data<I>(), size_};
+    }
+
+    /** @brief Pointer mentah ke kolom field ke-I (aligned ke column_align) */
+    template <size_t I>
+    requires (I < field_count)
+    [[nodiscard]] field_type<I>* data() noexcept {
+        return std::launder(reinterpret_cast<field_type<I>*>(columns_[I]));
+    }
+
+    template <size_t I>
+    requires (I < field_count)
+    [[nodiscard]] const field_type<I>* data() const noexcept {
+        return std::launder(reinterpret_cast<const field_type<I>*>(columns_[I]));
+    }
+
+    // ============= Row Access =============
+
+    [[nodiscard]] row_ref operator[](size_type i) noexcept { return {this, i}; }
+    [[nodiscard]] const_row_ref operator[](size_type i) const noexcept { return {this, i}; }
+    [[nodiscard]] row_ref front() noexcept { return {this, 0}; }
+    [[nodiscard]] const_row_ref front() const noexcept { return {this, 0}; }
+    [[nodiscard]] row_ref back() noexcept { return {this, size_ - 1}; }
+    [[nodiscard]] const_row_ref back() const noexcept { return {this, size_ - 1}; }
+
+    // ============= Modifiers =============
+
+    /** @brief Tambah baris dari nilai per field */
+    void push_back(const Ts&... values) {
+        grow_for(size_ + 1);
+        store_row(size_, values..., std::index_sequence_for<Ts...>{});
+        ++size_;
+    }
+
+    /** @brief Tambah baris dari struct AoS */
+    template <typename Struct>
+    requires aos_compatible<Struct, Ts...>
+    void push_back(const Struct& s) {
+        grow_for(size_ + 1);
+        scatter_rows(reinterpret_cast<const uint8_t*>(&s), size_, 1);
+        ++size_;
+    }
+
+    void pop_back() noexcept {
+        if (size_) --size_;
+    }
+
+    void swap(soa_vector& o) noexcept {
+        for (size_type f = 0; f < field_count; ++f) std::swap(columns_[f], o.columns_[f]);
+        std::swap(size_, o.size_);
+        std::swap(capacity_, o.capacity_);
+    }
+
+    // ============= Bulk AoS Transpose =============
+
+    /**
+     * @brief Append semua baris dari array-of-structs
+     *
+     * Transpose dilakukan per tile (transpose_tile baris) sehingga tile AoS
+     * tetap di L1 selama setiap kolom diisi.
+     */
+    template <typename Struct>
+    requires aos_compatible<Struct, Ts...>
+    void import_aos(std::span<const Struct> rows) {
+        if (rows.empty()) return;
+        grow_for(size_ + rows.size());
+        scatter_rows(reinterpret_cast<const uint8_t*>(rows.data()), size_, rows.size());
+        size_ += rows.size();
+    }
+
+    /**
+     * @brief Salin baris [first, first + out.size()) ke array-of-structs
+     * @return Jumlah baris yang disalin (dibatasi oleh size())
+     */
+    template <typename Struct>
+    requires aos_compatible<Struct, Ts...>
+    size_type export_aos(std::span<Struct> out, size_type first = 0) const noexcept {
+        if (first >= size_) return 0;
+        const size_type n = out.size() < size_ - first ? out.size() : size_ - first;
+        gather_rows(reinterpret_cast<uint8_t*>(out.data()), first, n);
+        return n;
+    }
+};
+
+/** @brief Free function swap */
+template <typename... Ts>
+void swap(soa_vector<Ts...>& a, soa_vector<Ts...>& b) noexcept {
+    a.swap(b);
+}
+
+} // namespace zuu
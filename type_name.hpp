@@ -0,0 +1,186 @@
+#pragma once
+
+/**
+ * @file type_name.hpp
+ * @brief Nama tipe dan minimal perfect hash dari nama ke index type_list_t
+ * @version 1.0.0
+ *
+ * Setiap tipe diberi nama lewat trait type_name<T> (default: member statis
+ * T::type_name). Tabel hash dibangun saat compile-time dengan skema
+ * hash-and-displace, sehingga lookup runtime hanya dua hash, satu load
+ * displacement, dan satu perbandingan string untuk verifikasi.
+ *
+ * @example
+ * ```cpp
+ * struct Trade { static constexpr std::string_view type_name = "trade"; ... };
+ * struct Quote { static constexpr std::string_view type_name = "quote"; ... };
+ * using list = type_list_t<Trade, Quote>;
+ * size_t i = index_from_name<list>("quote");  // 1
+ * ```
+ */
+
+#include "typelist.hpp"
+#include <concepts>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+
+namespace zuu {
+
+// ============= Type Name Trait =============
+
+/**
+ * @brief Nama tipe untuk lookup berbasis string
+ *
+ * Default membaca T::type_name. Specialize untuk tipe yang tidak bisa diberi
+ * member (mis. tipe fundamental).
+ */
+template <typename T>
+struct type_name {};
+
+template <typename T>
+requires requires { { T::type_name } -> std::convertible_to<std::string_view>; }
+struct type_name<T> {
+    static constexpr std::string_view value = T::type_name;
+};
+
+template <typename T>
+inline constexpr std::string_view type_name_v = type_name<T>::value;
+
+/** @brief Cek apakah T memiliki nama */
+template <typename T>
+concept named_type = requires { { type_name<T>::value } -> std::convertible_to<std::string_view>; };
+
+namespace detail {
+
+// ============= Hash Primitive =============
+
+/** @brief FNV-1a 32-bit dengan seed + final mix */
+[[nodiscard]] constexpr uint32_t name_hash(std::string_view s, uint32_t seed) noexcept {
+    uint32_t h = 2166136261u ^ seed;
+    for (char c : s) {
+        h ^= static_cast<uint8_t>(c);
+        h *= 16777619u;
+    }
+    h ^= h >> 16;
+    h *= 0x85ebca6bu;
+    h ^= h >> 13;
+    return h;
+}
+
+/** @brief Reduksi range tanpa modulo: [0, n) */
+[[nodiscard]] constexpr uint32_t reduce_range(uint32_t h, uint32_t n) noexcept {
+    return static_cast<uint32_t>((static_cast<uint64_t>(h) * n) >> 32);
+}
+
+// ============= Perfect Hash Builder =============
+
+/**
+ * @brief Minimal perfect hash (hash-and-displace) untuk N nama
+ *
+ * Level 1: name_hash(s, 0) memilih bucket. Level 2: name_hash(s, disp[bucket])
+ * memilih slot. Displacement dicari per bucket (bucket terbesar dahulu)
+ * sampai semua anggota bucket jatuh ke slot kosong.
+ */
+template <size_t N>
+struct perfect_hash_table {
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    uint32_t disp[N]{};
+    std::string_view names[N]{};
+    size_t index[N]{};
+
+    constexpr explicit perfect_hash_table(const std::string_view (&keys)[N]) {
+        constexpr uint32_t n = static_cast<uint32_t>(N);
+
+        for (size_t i = 0; i < N; ++i)
+            for (size_t j = i + 1; j < N; ++j)
+                if (keys[i] == keys[j]) throw "duplicate type name in type list";
+
+        uint32_t bucket_of[N]{};
+        size_t bucket_size[N]{};
+        for (size_t i = 0; i < N; ++i) {
+            bucket_of[i] = reduce_range(name_hash(keys[i], 0), n);
+            ++bucket_size[bucket_of[i]];
+        }
+
+        // Urutkan bucket berdasarkan ukuran descending
+        size_t order[N]{};
+        for (size_t b = 0; b < N; ++b) order[b] = b;
+        for (size_t i = 1; i < N; ++i) {
+            const size_t key = order[i];
+            size_t j = i;
+            while (j > 0 && bucket_size[order[j - 1]] < bucket_size[key]) {
+                order[j] = order[j - 1];
+                --j;
+            }
+            order[j] = key;
+        }
+
+        bool used[N]{};
+        for (size_t k = 0; k < N && bucket_size[order[k]] > 0; ++k) {
+            const uint32_t b = static_cast<uint32_t>(order[k]);
+            for (uint32_t d = 1;; ++d) {
+                if (d == 0x100000u) throw "perfect hash construction failed";
+                uint32_t slots[N]{};
+                size_t placed = 0;
+                bool ok = true;
+                for (size_t i = 0; i < N && ok; ++i) {
+                    if (bucket_of[i] != b) continue;
+                    const uint32_t s = reduce_range(name_hash(keys[i], d), n);
+                    ok = !used[s];
+                    for (size_t p = 0; p < placed && ok; ++p) ok = slots[p] != s;
+                    slots[placed++] = s;
+                }
+                if (!ok) continue;
+
+                disp[b] = d;
+                placed = 0;
+                for (size_t i = 0; i < N; ++i) {
+                    if (bucket_of[i] != b) continue;
+                    const uint32_t s = slots[placed++];
+                    used[s] = true;
+                    names[s] = keys[i];
+                    index[s] = i;
+                }
+                break;
+            }
+        }
+    }
+
+    /** @brief Index untuk nama s, npos jika tidak dikenal */
+    [[nodiscard]] constexpr size_t find(std::string_view s) const noexcept {
+        constexpr uint32_t n = static_cast<uint32_t>(N);
+        const uint32_t d = disp[reduce_range(name_hash(s, 0), n)];
+        const uint32_t slot = reduce_range(name_hash(s, d), n);
+        return names[slot] == s ? index[slot] : npos;
+    }
+};
+
+template <typename List>
+struct name_index_impl;
+
+template <typename... Ts>
+struct name_index_impl<type_list_t<Ts...>> {
+    static_assert((named_type<Ts> && ...), "All types must have a type_name");
+
+    static constexpr std::string_view names[] = {type_name_v<Ts>...};
+    static constexpr perfect_hash_table<sizeof...(Ts)> table{names};
+};
+
+} // namespace detail
+
+// ============= Public Interface =============
+
+/**
+ * @brief Index tipe dalam List berdasarkan nama
+ * @tparam List type_list_t dengan semua tipe memiliki type_name
+ * @return Index tipe, atau size_t(-1) jika nama tidak dikenal
+ */
+template <typename List>
+requires (is_type_list_v<List> && List::count > 0)
+[[nodiscard]] constexpr size_t index_from_name(std::string_view name) noexcept {
+    return detail::name_index_impl<List>::table.find(name);
+}
+
+} // namespace zuu
@@ -3,7 +3,7 @@
 /**
  * @file typelist.hpp
  * @brief Compile-time type list utilities
- * @version 1.1.0
+ * @version 1.2.0
  * 
  * Menyediakan metaprogramming utilities untuk manipulasi daftar tipe.
  * Semua operasi compile-time dengan zero runtime overhead.
@@ -11,9 +11,13 @@
 
 #include <cstddef>
 #include <type_traits>
+#include <utility>
 
 namespace zuu {
 
+template <typename... Ts>
+struct type_list_t;
+
 namespace detail {
 
 // ============= Max Helper =============
@@ -29,26 +33,70 @@ template <typename T, typename... Ts>
     else return max_val(a, max_val(rest...));
 }
 
+/** @brief Round up ke kelipatan alignment */
+[[nodiscard]] constexpr size_t align_up(size_t value, size_t align) noexcept {
+    return (value + align - 1) / align * align;
+}
+
 // ============= Type List Implementation =============
+//
+// Semua query di bawah memiliki kedalaman instansiasi O(1) terhadap jumlah
+// tipe: tidak ada rekursi per elemen, sehingga list ribuan tipe tetap murah
+// untuk di-compile.
 
 template <typename... Ts>
 struct type_list {
     static constexpr size_t count = sizeof...(Ts);
 };
 
+#if defined(__has_builtin)
+#  if __has_builtin(__type_pack_element)
+#    define ZUU_HAS_TYPE_PACK_ELEMENT 1
+#  endif
+#endif
+
+/** @brief Tag untuk lookup berbasis inheritance (index -> tipe) */
+template <size_t I, typename T>
+struct indexed_type {
+    using type = T;
+};
+
+template <typename Seq, typename... Ts>
+struct indexed_types;
+
+template <size_t... Is, typename... Ts>
+struct indexed_types<std::index_sequence<Is...>, Ts...> : indexed_type<Is, Ts>... {};
+
+/** @brief Overload resolution memilih satu-satunya base dengan index I */
+template <size_t I, typename T>
+indexed_type<I, T> select_indexed(const indexed_type<I, T>&);
+
 // Type at index
 template <size_t N, typename List>
 struct type_at_impl;
 
-template <size_t N, typename T, typename... Ts>
-struct type_at_impl<N, type_list<T, Ts...>> {
-    using type = typename type_at_impl<N - 1, type_list<Ts...>>::type;
+#ifdef ZUU_HAS_TYPE_PACK_ELEMENT
+template <size_t N, typename... Ts>
+struct type_at_impl<N, type_list<Ts...>> {
+    using type = __type_pack_element<N, Ts...>;
 };
-
-template <typename T, typename... Ts>
-struct type_at_impl<0, type_list<T, Ts...>> {
-    using type = T;
+#else
+template <size_t N, typename... Ts>
+struct type_at_impl<N, type_list<Ts...>> {
+    using type = typename decltype(select_indexed<N>(
+        std::declval<indexed_types<std::index_sequence_for<Ts...>, Ts...>>()))::type;
 };
+#endif
+#undef ZUU_HAS_TYPE_PACK_ELEMENT
+
+/** @brief Index pertama dari true dalam flags (-1 jika tidak ada) */
+template <size_t N>
+[[nodiscard]] constexpr size_t find_first_true(const bool (&flags)[N]) noexcept {
+    for (size_t i = 0; i < N; ++i) {
+        if (flags[i]) return i;
+    }
+    return static_cast<size_t>(-1);
+}
 
 // Index of type
 template <typename T, typename List>
@@ -60,25 +108,134 @@ struct index_of_impl<T, type_list<>> {
 };
 
 template <typename T, typename... Ts>
-struct index_of_impl<T, type_list<T, Ts...>> {
-    static constexpr size_t value = 0;
-};
-
-template <typename T, typename U, typename... Us>
-struct index_of_impl<T, type_list<U, Us...>> {
-    static constexpr size_t value = 1 + index_of_impl<T, type_list<Us...>>::value;
+struct index_of_impl<T, type_list<Ts...>> {
+    static constexpr bool matches[] = {std::is_same_v<T, Ts>...};
+    static constexpr size_t value = find_first_true(matches);
 };
 
 // Contains type
 template <typename T, typename List>
 struct contains_impl;
 
+template <typename T, typename... Ts>
+struct contains_impl<T, type_list<Ts...>> 
+    : std::bool_constant<(std::is_same_v<T, Ts> || ...)> {};
+
+// ============= Transformations =============
+//
+// filter/sort_by menghitung tabel index secara constexpr lalu memilih
+// tipe lewat type_at_impl, sehingga kedalaman instansiasi tetap O(1).
+
+/** @brief Daftar index hasil seleksi (kapasitas N) */
+template <size_t N>
+struct index_table {
+    size_t value[N > 0 ? N : 1]{};
+    size_t count = 0;
+};
+
+template <typename List, auto Table, typename Seq = std::make_index_sequence<Table.count>>
+struct select_impl;
+
+template <typename... Ts, auto Table, size_t... Is>
+struct select_impl<type_list_t<Ts...>, Table, std::index_sequence<Is...>> {
+    using type = type_list_t<typename type_at_impl<Table.value[Is], type_list<Ts...>>::type...>;
+};
+
+/** @brief Ambil index i dimana keep[i] true (urutan dipertahankan) */
+template <size_t N>
+[[nodiscard]] constexpr index_table<N> indices_where(const bool (&keep)[N]) noexcept {
+    index_table<N> r{};
+    for (size_t i = 0; i < N; ++i) {
+        if (keep[i]) r.value[r.count++] = i;
+    }
+    return r;
+}
+
+// Concat
+template <typename... Lists>
+struct concat_impl {
+    using type = type_list_t<>;
+};
+
+template <typename... Ts>
+struct concat_impl<type_list_t<Ts...>> {
+    using type = type_list_t<Ts...>;
+};
+
+template <typename... As, typename... Bs, typename... Rest>
+struct concat_impl<type_list_t<As...>, type_list_t<Bs...>, Rest...>
+    : concat_impl<type_list_t<As..., Bs...>, Rest...> {};
+
+// Filter
+template <typename List, template <typename> class Pred>
+struct filter_impl {
+    using type = type_list_t<>;
+};
+
+template <typename T, typename... Ts, template <typename> class Pred>
+struct filter_impl<type_list_t<T, Ts...>, Pred> {
+    static constexpr bool keep[] = {static_cast<bool>(Pred<T>::value),
+                                    static_cast<bool>(Pred<Ts>::value)...};
+    using type = typename select_impl<type_list_t<T, Ts...>, indices_where(keep)>::type;
+};
+
+// Unique (kemunculan pertama dipertahankan)
+//
+// Satu fold kiri atas list: state unique_step<Us...> mewarisi type_tag<Us>...
+// sehingga "sudah pernah muncul?" = satu std::is_base_of, tanpa index_of
+// per elemen. Instansiasi tumbuh linear (satu state per tipe unik + satu
+// is_base_of per elemen) dan tanpa rekursi template.
+
 template <typename T>
-struct contains_impl<T, type_list<>> : std::false_type {};
+struct type_tag {};
+
+template <typename... Us>
+struct unique_step : type_tag<Us>... {
+    using type = type_list_t<Us...>;
+
+    template <typename T>
+    auto operator+(type_tag<T>) const
+        -> std::conditional_t<std::is_base_of_v<type_tag<T>, unique_step>, unique_step, unique_step<Us..., T>>;
+};
+
+template <typename List>
+struct unique_impl {
+    using type = type_list_t<>;
+};
+
+template <typename... Ts>
+struct unique_impl<type_list_t<Ts...>> {
+    using type = typename decltype((unique_step<>{} + ... + type_tag<Ts>{}))::type;
+};
 
-template <typename T, typename U, typename... Us>
-struct contains_impl<T, type_list<U, Us...>> 
-    : std::bool_constant<std::is_same_v<T, U> || contains_impl<T, type_list<Us...>>::value> {};
+// Sort by key (stable, ascending)
+template <typename List, template <typename> class Key>
+struct sort_by_impl {
+    using type = type_list_t<>;
+};
+
+template <typename T, typename... Ts, template <typename> class Key>
+struct sort_by_impl<type_list_t<T, Ts...>, Key> {
+    static constexpr auto order = [] {
+        constexpr decltype(Key<T>::value) keys[] = {Key<T>::value, Key<Ts>::value...};
+        constexpr size_t n = 1 + sizeof...(Ts);
+        index_table<n> r{};
+        r.count = n;
+        for (size_t i = 0; i < n; ++i) r.value[i] = i;
+        // Stable insertion sort: urutan asli dipertahankan untuk key sama
+        for (size_t i = 1; i < n; ++i) {
+            const size_t idx = r.value[i];
+            size_t j = i;
+            while (j > 0 && keys[idx] < keys[r.value[j - 1]]) {
+                r.value[j] = r.value[j - 1];
+                --j;
+            }
+            r.value[j] = idx;
+        }
+        return r;
+    }();
+    using type = typename select_impl<type_list_t<T, Ts...>, order>::type;
+};
 
 } // namespace detail
 
@@ -95,6 +252,10 @@ struct contains_impl<T, type_list<U, Us...>>
  * static_assert(list::contains<int>);
  * static_assert(list::index_of<double> == 1);
  * using second = list::type<1>;  // double
+ *
+ * using ints = list::filter<std::is_integral>;      // type_list_t<int>
+ * using ptrs = list::transform<std::add_pointer_t>; // type_list_t<int*, double*, float*>
+ * using var  = unique_t<concat_t<list, ints>>::apply<generic>;
  * ```
  */
 template <typename... Ts>
@@ -146,8 +307,52 @@ struct type_list_t {
     
     /** @brief Cek apakah semua tipe nothrow default constructible */
     static constexpr bool all_nothrow_default = (std::is_nothrow_default_constructible_v<Ts> && ...);
+
+    // ============= Transformations =============
+
+    /** @brief Tipe T dimana Pred<T>::value true (urutan dipertahankan) */
+    template <template <typename> class Pred>
+    using filter = typename detail::filter_impl<type_list_t, Pred>::type;
+
+    /** @brief Map setiap tipe lewat F<T> (alias template, mis. std::add_pointer_t) */
+    template <template <typename> class F>
+    using transform = type_list_t<F<Ts>...>;
+
+    /** @brief Stable sort ascending berdasarkan Key<T>::value */
+    template <template <typename> class Key>
+    using sort_by = typename detail::sort_by_impl<type_list_t, Key>::type;
+
+    /** @brief Instansiasi Template<Ts...> (mis. generic, packed_tuple) */
+    template <template <typename...> class Template>
+    using apply = Template<Ts...>;
 };
 
+// ============= Transformation Aliases =============
+
+/** @brief Gabungkan beberapa type_list_t menjadi satu */
+template <typename... Lists>
+using concat_t = typename detail::concat_impl<Lists...>::type;
+
+/** @brief Hapus duplikat, kemunculan pertama dipertahankan */
+template <typename List>
+using unique_t = typename detail::unique_impl<List>::type;
+
+/** @brief List::filter<Pred> */
+template <typename List, template <typename> class Pred>
+using filter_t = typename detail::filter_impl<List, Pred>::type;
+
+/** @brief List::transform<F> */
+template <typename List, template <typename> class F>
+using transform_t = typename List::template transform<F>;
+
+/** @brief List::sort_by<Key> */
+template <typename List, template <typename> class Key>
+using sort_by_t = typename detail::sort_by_impl<List, Key>::type;
+
+/** @brief List::apply<Template> */
+template <typename List, template <typename...> class Template>
+using apply_t = typename List::template apply<Template>;
+
 // ============= Type Traits =============
 
 /** @brief Check if type is a type_list_t */
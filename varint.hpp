@@ -0,0 +1,428 @@
+#pragma once
+
+/**
+ * @file varint.hpp
+ * @brief Varint LEB128 dan zigzag untuk nilai tunggal dan stream integer
+ * @version 1.0.0
+ *
+ * Format: 7 bit data per byte (little-endian), bit 7 = lanjutan. Tipe signed
+ * selalu di-zigzag dulu (setara sint32/sint64 protobuf) sehingga nilai
+ * negatif kecil tetap pendek.
+ *
+ * Menyediakan:
+ * - zigzag_encode / zigzag_decode
+ * - encode_varint / append_varint / decode_varint untuk satu nilai
+ *   (decode: satu load 64-bit + kompaksi 7-bit tanpa loop per byte)
+ * - append_varints / decode_varints untuk stream: decoder bulk gaya
+ *   Masked-VByte (SSSE3) — pmovmskb 16 byte, tabel 12-bit ke pola pshufb
+ *   yang men-decode 4..16 nilai sekaligus, fallback scalar per nilai
+ * - Overload untuk composer<T> dengan T integral
+ *
+ * @note Error dilaporkan seperti std::from_chars: errc::invalid_argument jika
+ *       input terpotong, errc::result_out_of_range jika nilai tidak muat di T;
+ *       ptr menunjuk awal varint yang gagal
+ *
+ * @example
+ * ```cpp
+ * byte_buffer wire;
+ * append_varint(wire, uint32_t{300});       // 0xAC 0x02
+ * append_varint(wire, int64_t{-3});         // zigzag -> 5
+ * append_varints(wire, std::span<const uint32_t>(ids));
+ *
+ * uint32_t x;
+ * auto r = decode_varint(wire.data(), wire.data() + wire.size(), x);
+ * if (r.ec != std::errc{}) { ... }
+ *
+ * std::vector<uint32_t> out(ids.size());
+ * auto s = decode_varints(p, end, std::span(out));   // s.count, s.ptr
+ * ```
+ */
+
+#include "byte_buffer.hpp"
+#include "composer.hpp"
+#include "endian.hpp"
+#include "simd.hpp"
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstdint>
+#include <span>
+#include <system_error>
+#include <type_traits>
+
+namespace zuu {
+
+/** @brief Integer yang bisa di-encode sebagai varint (bool tidak) */
+template <typename T>
+concept varint_integer = std::integral<T> && !std::same_as<T, bool>;
+
+/** @brief Hasil decode satu varint (gaya std::from_chars_result) */
+struct varint_result {
+    const uint8_t* ptr;
+    std::errc ec;
+};
+
+/** @brief Hasil decode stream: count nilai berhasil, ptr setelah nilai terakhir */
+struct varints_result {
+    const uint8_t* ptr;
+    size_t count;
+    std::errc ec;
+};
+
+// ============= Zigzag =============
+
+/** @brief 0, -1, 1, -2, ... -> 0, 1, 2, 3, ... */
+template <std::signed_integral T>
+[[nodiscard]] constexpr std::make_unsigned_t<T> zigzag_encode(T v) noexcept {
+    using U = std::make_unsigned_t<T>;
+    return static_cast<U>((static_cast<U>(v) << 1) ^ static_cast<U>(v < 0 ? ~U{0} : U{0}));
+}
+
+template <std::unsigned_integral U>
+[[nodiscard]] constexpr std::make_signed_t<U> zigzag_decode(U v) noexcept {
+    return static_cast<std::make_signed_t<U>>(static_cast<U>((v >> 1) ^ (U{0} - (v & 1))));
+}
+
+// ============= Sizes =============
+
+/** @brief Panjang maksimum varint untuk T (uint32 -> 5, uint64 -> 10) */
+template <varint_integer T>
+inline constexpr size_t varint_max_bytes = (sizeof(T) * 8 + 6) / 7;
+
+namespace detail::varint {
+
+/** @brief Nilai unsigned yang di-encode untuk v (zigzag jika signed) */
+template <varint_integer T>
+[[nodiscard]] constexpr uint64_t to_wire(T v) noexcept {
+    if constexpr (std::is_signed_v<T>) return zigzag_encode(v);
+    else return v;
+}
+
+/** @brief Kebalikan to_wire; false jika w tidak muat di T */
+template <varint_integer T>
+[[nodiscard]] constexpr bool from_wire(uint64_t w, T& out) noexcept {
+    using U = std::make_unsigned_t<T>;
+    if constexpr (sizeof(U) < 8) {
+        if (w >> (sizeof(U) * 8)) return false;
+    }
+    if constexpr (std::is_signed_v<T>) out = zigzag_decode(static_cast<U>(w));
+    else out = static_cast<U>(w);
+    return true;
+}
+
+[[nodiscard]] constexpr size_t size_of(uint64_t w) noexcept {
+    const auto bits = static_cast<size_t>(std::bit_width(w));
+    return bits ? (bits + 6) / 7 : 1;
+}
+
+/** @brief Gabungkan 7-bit rendah dari 8 byte (bit 7 sudah nol) menjadi 56 bit */
+[[nodiscard]] constexpr uint64_t compact(uint64_t x) noexcept {
+    x = (x & 0x007F007F007F007Full) | ((x & 0x7F007F007F007F00ull) >> 1);
+    x = (x & 0x00003FFF00003FFFull) | ((x & 0x3FFF00003FFF0000ull) >> 2);
+    return (x & 0x000000000FFFFFFFull) | ((x & 0x0FFFFFFF00000000ull) >> 4);
+}
+
+/** @brief Encode per byte; out minimal 10 byte */
+constexpr size_t encode_loop(uint64_t w, uint8_t* out) noexcept {
+    size_t n = 0;
+    while (w >= 0x80) {
+        out[n++] = static_cast<uint8_t>(w | 0x80);
+        w >>= 7;
+    }
+    out[n++] = static_cast<uint8_t>(w);
+    return n;
+}
+
+/** @brief Decode per byte; 0 jika terpotong, SIZE_MAX jika melebihi 64 bit */
+constexpr size_t decode_loop(const uint8_t* p, const uint8_t* last, uint64_t& w) noexcept {
+    uint64_t v = 0;
+    for (size_t i = 0; i < 10 && p + i < last; ++i) {
+        const uint8_t b = p[i];
+        if (i == 9 && b > 1) return SIZE_MAX;
+        v |= static_cast<uint64_t>(b & 0x7F) << (7 * i);
+        if (!(b & 0x80)) {
+            w = v;
+            return i + 1;
+        }
+    }
+    return (last - p) >= 10 ? SIZE_MAX : 0;
+}
+
+/**
+ * @brief Decode satu varint; panjang byte, 0 jika terpotong, SIZE_MAX jika overflow
+ *
+ * Jika >= 8 byte tersedia: terminator dicari dengan ~w & 0x80.., byte
+ * sebelum dan termasuk terminator dimask lalu dikompaksi (tanpa cabang per byte).
+ */
+inline size_t decode_one(const uint8_t* p, const uint8_t* last, uint64_t& w) noexcept {
+    if (last - p >= 8) {
+        const uint64_t word = load_le64(p);
+        const uint64_t stop = ~word & 0x8080808080808080ull;
+        if (stop) {
+            w = compact(word & (stop ^ (stop - 1)) & 0x7F7F7F7F7F7F7F7Full);
+            return static_cast<size_t>(std::countr_zero(stop)) / 8 + 1;
+        }
+    }
+    return decode_loop(p, last, w);
+}
+
+// ============= Bulk Decode Kernels =============
+
+/** @brief Decode tepat n nilai mulai p */
+template <varint_integer T>
+using decode_fn = varints_result (*)(const uint8_t* p, const uint8_t* last, T* out, size_t n) noexcept;
+
+template <varint_integer T>
+inline varints_result decode_scalar(const uint8_t* p, const uint8_t* last, T* out, size_t n) noexcept {
+    for (size_t i = 0; i < n; ++i) {
+        uint64_t w = 0;
+        const size_t len = decode_one(p, last, w);
+        if (len == 0) return {p, i, std::errc::invalid_argument};
+        if (len == SIZE_MAX || !from_wire(w, out[i])) return {p, i, std::errc::result_out_of_range};
+        p += len;
+    }
+    return {p, n, std::errc{}};
+}
+
+#ifdef ZUU_SIMD_X86
+
+/**
+ * @brief Entri tabel Masked-VByte untuk 12 bit mask lanjutan pertama
+ *
+ * kind 1: hingga 8 nilai <= 2 byte di lane 16-bit; kind 2: hingga 4 nilai
+ * <= 4 byte di lane 32-bit; kind 0: nilai pertama > 4 byte atau tidak
+ * selesai dalam 12 byte (decode scalar satu nilai).
+ */
+struct mvb_entry {
+    uint8_t shuffle[16];
+    uint8_t count;
+    uint8_t consumed;
+    uint8_t kind;
+};
+
+[[nodiscard]] constexpr std::array<mvb_entry, 4096> make_mvb_table() noexcept {
+    std::array<mvb_entry, 4096> t{};
+    for (unsigned m = 0; m < 4096; ++m) {
+        unsigned start[12]{}, len[12]{}, n = 0;
+        for (unsigned pos = 0; pos < 12;) {
+            unsigned j = pos;
+            while (j < 12 && (m >> j) & 1) ++j;
+            if (j == 12) break;
+            start[n] = pos;
+            len[n++] = j - pos + 1;
+            pos = j + 1;
+        }
+        unsigned run2 = 0, run4 = 0;
+        while (run2 < n && run2 < 8 && len[run2] <= 2) ++run2;
+        while (run4 < n && run4 < 4 && len[run4] <= 4) ++run4;
+
+        mvb_entry& e = t[m];
+        for (auto& s : e.shuffle) s = 0x80;
+        if (run2 && run2 >= run4) {
+            e.kind = 1;
+            e.count = static_cast<uint8_t>(run2);
+            for (unsigned i = 0; i < run2; ++i) {
+                e.shuffle[2 * i] = static_cast<uint8_t>(start[i]);
+                if (len[i] == 2) e.shuffle[2 * i + 1] = static_cast<uint8_t>(start[i] + 1);
+                e.consumed = static_cast<uint8_t>(e.consumed + len[i]);
+            }
+        } else if (run4) {
+            e.kind = 2;
+            e.count = static_cast<uint8_t>(run4);
+            for (unsigned i = 0; i < run4; ++i) {
+                for (unsigned b = 0; b < len[i]; ++b) e.shuffle[4 * i + b] = static_cast<uint8_t>(start[i] + b);
+                e.consumed = static_cast<uint8_t>(e.consumed + len[i]);
+            }
+        }
+    }
+    return t;
+}
+
+inline constexpr std::array<mvb_entry, 4096> mvb_table = make_mvb_table();
+
+/** @brief Tulis 4 nilai wire (< 2^28, lane 32-bit) sebagai T */
+template <varint_integer T>
+ZUU_TARGET("ssse3")
+inline void emit4(__m128i v, T* out) noexcept {
+    if constexpr (std::is_signed_v<T>) {
+        v = _mm_xor_si128(_mm_srli_epi32(v, 1), _mm_sub_epi32(_mm_setzero_si128(), _mm_and_si128(v, _mm_set1_epi32(1))));
+    }
+    if constexpr (sizeof(T) == 4) {
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), v);
+    } else {
+        const __m128i hi = std::is_signed_v<T> ? _mm_srai_epi32(v, 31) : _mm_setzero_si128();
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_unpacklo_epi32(v, hi));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2), _mm_unpackhi_epi32(v, hi));
+    }
+}
+
+/**
+ * @brief Decoder Masked-VByte
+ *
+ * Selama >= 16 byte input dan >= 16 slot output tersisa: mask lanjutan 16
+ * byte via pmovmskb. Mask nol = 16 nilai satu byte (zero-extend langsung),
+ * 0x5555 = 8 nilai dua byte (lane 16-bit langsung); selain itu 12 bit
+ * rendah memilih pola pshufb, lalu 7-bit digabung dengan and/shift/or per
+ * lane. Sisa dan nilai > 4 byte memakai decode_one.
+ */
+template <varint_integer T>
+ZUU_TARGET("ssse3")
+inline varints_result decode_ssse3(const uint8_t* p, const uint8_t* last, T* out, size_t n) noexcept {
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lo7 = _mm_set1_epi16(0x007F), hi7 = _mm_set1_epi16(0x7F00);
+    const __m128i lo14 = _mm_set1_epi32(0x3FFF), hi14 = _mm_set1_epi32(0x3FFF0000);
+    const __m128i low7 = _mm_set1_epi8(0x7F);
+    size_t i = 0;
+    while (last - p >= 16 && n - i >= 16) {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+        const auto mask = static_cast<unsigned>(_mm_movemask_epi8(in));
+        if (mask == 0) {
+            const __m128i w0 = _mm_unpacklo_epi8(in, zero), w1 = _mm_unpackhi_epi8(in, zero);
+            emit4(_mm_unpacklo_epi16(w0, zero), out + i);
+            emit4(_mm_unpackhi_epi16(w0, zero), out + i + 4);
+            emit4(_mm_unpacklo_epi16(w1, zero), out + i + 8);
+            emit4(_mm_unpackhi_epi16(w1, zero), out + i + 12);
+            p += 16;
+            i += 16;
+            continue;
+        }
+        if (mask == 0x5555) {
+            // 8 nilai dua byte: lane 16-bit sudah sejajar, tanpa pshufb
+            const __m128i v = _mm_or_si128(_mm_and_si128(in, lo7), _mm_srli_epi16(_mm_and_si128(in, hi7), 1));
+            emit4(_mm_unpacklo_epi16(v, zero), out + i);
+            emit4(_mm_unpackhi_epi16(v, zero), out + i + 4);
+            p += 16;
+            i += 8;
+            continue;
+        }
+        const mvb_entry& e = mvb_table[mask & 0xFFF];
+        if (e.kind == 0) {
+            const auto r = decode_scalar(p, last, out + i, 1);
+            if (r.ec != std::errc{}) return {p, i, r.ec};
+            p = r.ptr;
+            ++i;
+            continue;
+        }
+        const __m128i x = _mm_shuffle_epi8(in, _mm_loadu_si128(reinterpret_cast<const __m128i*>(e.shuffle)));
+        if (e.kind == 1) {
+            const __m128i v = _mm_or_si128(_mm_and_si128(x, lo7), _mm_srli_epi16(_mm_and_si128(x, hi7), 1));
+            emit4(_mm_unpacklo_epi16(v, zero), out + i);
+            emit4(_mm_unpackhi_epi16(v, zero), out + i + 4);
+        } else {
+            const __m128i a = _mm_and_si128(x, low7);
+            const __m128i b = _mm_or_si128(_mm_and_si128(a, lo7), _mm_srli_epi16(_mm_and_si128(a, hi7), 1));
+            emit4(_mm_or_si128(_mm_and_si128(b, lo14), _mm_srli_epi32(_mm_and_si128(b, hi14), 2)), out + i);
+        }
+        p += e.consumed;
+        i += e.count;
+    }
+    const auto r = decode_scalar(p, last, out + i, n - i);
+    return {r.ptr, i + r.count, r.ec};
+}
+
+#endif // ZUU_SIMD_X86
+
+template <varint_integer T>
+[[nodiscard]] inline decode_fn<T> select_decode() noexcept {
+#ifdef ZUU_SIMD_X86
+    if constexpr (sizeof(T) >= 4) {
+        if (is_little_endian && simd::cpu().ssse3) return &decode_ssse3<T>;
+    }
+#endif
+    return &decode_scalar<T>;
+}
+
+/** @brief Nilai per putaran append_varints (bound buffer sementara) */
+inline constexpr size_t encode_chunk = 1024;
+
+} // namespace detail::varint
+
+// ============= Single Value =============
+
+/** @brief Jumlah byte varint untuk v */
+template <varint_integer T>
+[[nodiscard]] constexpr size_t varint_size(T v) noexcept {
+    return detail::varint::size_of(detail::varint::to_wire(v));
+}
+
+/**
+ * @brief Encode v ke out
+ * @param out Minimal varint_max_bytes<T> byte
+ * @return Jumlah byte yang ditulis
+ */
+template <varint_integer T>
+constexpr size_t encode_varint(T v, uint8_t* out) noexcept {
+    return detail::varint::encode_loop(detail::varint::to_wire(v), out);
+}
+
+template <varint_integer T>
+void append_varint(byte_buffer& buf, T v) {
+    uint8_t tmp[10];
+    buf.append(bytes_view(tmp, encode_varint(v, tmp)));
+}
+
+template <varint_integer T>
+void append_varint(byte_buffer& buf, const composer<T>& c) {
+    append_varint(buf, c.value());
+}
+
+/** @brief Decode satu varint dari [first, last) ke value (tidak diubah jika gagal) */
+template <varint_integer T>
+inline varint_result decode_varint(const uint8_t* first, const uint8_t* last, T& value) noexcept {
+    uint64_t w = 0;
+    const size_t len = detail::varint::decode_one(first, last, w);
+    if (len == 0) return {first, std::errc::invalid_argument};
+    T v{};
+    if (len == SIZE_MAX || !detail::varint::from_wire(w, v)) return {first, std::errc::result_out_of_range};
+    value = v;
+    return {first + len, std::errc{}};
+}
+
+template <varint_integer T>
+inline varint_result decode_varint(bytes_view in, T& value) noexcept {
+    return decode_varint(in.data(), in.data() + in.size(), value);
+}
+
+template <varint_integer T>
+inline varint_result decode_varint(bytes_view in, composer<T>& c) noexcept {
+    return decode_varint(in, c.value());
+}
+
+// ============= Streams =============
+
+/** @brief Tambahkan semua nilai sebagai varint berurutan */
+template <varint_integer T>
+void append_varints(byte_buffer& buf, std::span<const T> values) {
+    constexpr size_t chunk = detail::varint::encode_chunk;
+    for (size_t i = 0; i < values.size(); i += chunk) {
+        const size_t n = values.size() - i < chunk ? values.size() - i : chunk;
+        const size_t old = buf.size();
+        buf.resize(old + n * varint_max_bytes<T>);
+        uint8_t* out = buf.data() + old;
+        for (size_t j = 0; j < n; ++j) out += encode_varint(values[i + j], out);
+        buf.resize(static_cast<size_t>(out - buf.data()));
+    }
+}
+
+template <varint_integer T>
+void append_varints(byte_buffer& buf, std::span<const composer<T>> values) {
+    for (const auto& c : values) append_varint(buf, c.value());
+}
+
+/**
+ * @brief Decode tepat out.size() varint dari [first, last)
+ * @return count nilai yang valid di out; ptr setelahnya, atau di awal varint
+ *         yang gagal jika ec != errc{}
+ */
+template <varint_integer T>
+inline varints_result decode_varints(const uint8_t* first, const uint8_t* last, std::span<T> out) noexcept {
+    static const detail::varint::decode_fn<T> fn = detail::varint::select_decode<T>();
+    return fn(first, last, out.data(), out.size());
+}
+
+template <varint_integer T>
+inline varints_result decode_varints(bytes_view in, std::span<T> out) noexcept {
+    return decode_varints(in.data(), in.data() + in.size(), out);
+}
+
+} // namespace zuu